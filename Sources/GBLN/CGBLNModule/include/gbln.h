@@ -8,6 +8,13 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+/**
+ * Field count above which objects maintain a hash index
+ *
+ * Below this size a linear scan over the fields is faster than hashing.
+ */
+#define GBLN_OBJECT_INDEX_THRESHOLD 16
+
 /**
  * C-compatible error codes
  *
@@ -27,68 +34,1136 @@ typedef enum GblnErrorCode {
     ErrorDuplicateKey = 10,
     ErrorNullPointer = 11,
     ErrorIo = 12,
+    ErrorCallbackAborted = 13,
+    ErrorMissingField = 14,
 } GblnErrorCode;
 
 /**
- * Value type enum for C FFI
+ * Value type enum for C FFI
+ *
+ * Represents the type of a GBLN value.
+ * This allows C code to query the type without trying every accessor.
+ *
+ * # Decoding
+ * - `I8` ... `U64`: literals are decoded eight digits at a time (SWAR), with
+ *   range checks specialised per type hint; a literal outside the hinted
+ *   range fails the parse with `GBLN_ERROR_INT_OUT_OF_RANGE`
+ * - `F32` / `F64`: literals are decoded with correct rounding (nearest,
+ *   ties to even) by every parse entry point; an Eisel-Lemire fast path
+ *   handles almost all inputs, with an exact big-decimal fallback for the
+ *   rare ambiguous cases
+ */
+typedef enum GblnValueType {
+    I8 = 0,
+    I16 = 1,
+    I32 = 2,
+    I64 = 3,
+    U8 = 4,
+    U16 = 5,
+    U32 = 6,
+    U64 = 7,
+    F32 = 8,
+    F64 = 9,
+    Str = 10,
+    Bool = 11,
+    Null = 12,
+    Object = 13,
+    Array = 14,
+} GblnValueType;
+
+/**
+ * Structural scanner backend
+ *
+ * The parser's first stage scans the input for structural bytes
+ * (`{ } [ ] < > ( )` and `:|` comment starts) and builds a structural
+ * index that the tree builder consumes. The widest instruction set
+ * supported by the CPU is selected once, on first use:
+ *
+ * - `Avx2`: x86-64 CPUs reporting AVX2 (32 bytes per step)
+ * - `Sse42`: x86-64 CPUs with SSE4.2 but without AVX2 (16 bytes per step)
+ * - `Neon`: always on AArch64 (16 bytes per step)
+ * - `Scalar`: every other target, or when the `GBLN_SCANNER=scalar`
+ *   environment variable is set before the first parse
+ *
+ * All backends produce the same structural index.
+ */
+typedef enum GblnScannerBackend {
+    Scalar = 0,
+    Sse42 = 1,
+    Avx2 = 2,
+    Neon = 3,
+} GblnScannerBackend;
+
+/**
+ * Streaming event kind
+ */
+typedef enum GblnEventType {
+    EventBeginObject = 0,
+    EventEndObject = 1,
+    EventBeginArray = 2,
+    EventEndArray = 3,
+    EventKey = 4,
+    EventScalar = 5,
+} GblnEventType;
+
+/**
+ * Opaque pointer to a GBLN value
+ *
+ * This is a C-compatible wrapper around Rust's Value type.
+ * C code sees this as an opaque pointer and must use the provided
+ * accessor functions to interact with it.
+ *
+ * Note: This struct is intentionally opaque to C. The internal
+ * Value type is not exposed in the C header.
+ */
+typedef struct GblnValue GblnValue;
+
+/**
+ * Opaque wrapper for GblnConfig
+ */
+typedef struct GblnConfig GblnConfig;
+
+/**
+ * Opaque on-demand document
+ *
+ * Holds a compact tape of token offsets into the caller's input. Objects,
+ * arrays and scalars are decoded only when first reached through the
+ * regular accessors (`gbln_object_get()`, `gbln_array_get()`, ...).
+ */
+typedef struct GblnDoc GblnDoc;
+
+/**
+ * Streaming parse event
+ *
+ * Keyed values are reported as an `EventKey` followed by the value's
+ * `EventScalar`, `EventBeginObject` or `EventBeginArray`.
+ *
+ * All pointers are borrowed and valid only until the event has been handled.
+ */
+typedef struct GblnEvent {
+    /**
+     * Event kind
+     */
+    enum GblnEventType kind;
+    /**
+     * Value type: `Object`/`Array` for begin/end events, scalar type for `EventScalar`
+     */
+    enum GblnValueType value_type;
+    /**
+     * Key bytes for `EventKey` (UTF-8, NOT null-terminated), NULL otherwise
+     */
+    const uint8_t *text;
+    /**
+     * Key length in bytes
+     */
+    uintptr_t text_len;
+    /**
+     * Scalar value for `EventScalar`, NULL otherwise; read with `gbln_value_as_*()`
+     */
+    const struct GblnValue *value;
+} GblnEvent;
+
+/**
+ * Streaming event callback
+ *
+ * Return `GBLN_OK` to continue. Any other code stops parsing, and the
+ * feeding call returns `GBLN_ERROR_CALLBACK_ABORTED`.
+ */
+typedef enum GblnErrorCode (*GblnEventCallback)(const struct GblnEvent *event, void *user_data);
+
+/**
+ * Opaque incremental push parser
+ *
+ * Accepts input in arbitrary chunks and reports events as soon as they are
+ * complete. Tokens split across chunk boundaries are buffered internally.
+ */
+typedef struct GblnPushParser GblnPushParser;
+
+/**
+ * Opaque pull-based event reader
+ *
+ * Yields the same events as the push parser, one per `gbln_reader_next()`
+ * call, without building any value tree. Memory use is independent of the
+ * input size.
+ */
+typedef struct GblnReader GblnReader;
+
+/**
+ * Field description for a decoding schema
+ *
+ * Maps the value at `path` to a native field at `offset` bytes into the
+ * caller's struct. Native layouts per type:
+ * - `I8`..`U64`: `int8_t`..`uint64_t`
+ * - `F32` / `F64`: `float` / `double`
+ * - `Bool`: `bool`
+ * - `Str`: inline `char[capacity]`, written null-terminated
+ *
+ * `Null`, `Object` and `Array` are not valid field types; address nested
+ * fields by path instead.
+ */
+typedef struct GblnSchemaField {
+    /**
+     * Dot-separated path from the document root, e.g. `reading.sensor.id`
+     */
+    const char *path;
+    /**
+     * Expected value type; must match the document's type hint exactly
+     */
+    enum GblnValueType value_type;
+    /**
+     * Byte offset of the native field in the target struct
+     */
+    uintptr_t offset;
+    /**
+     * Size in bytes of the inline buffer for `Str` fields (including the null terminator), 0 otherwise
+     */
+    uintptr_t capacity;
+    /**
+     * Whether a missing field is an error; optional fields are left untouched
+     */
+    bool required;
+} GblnSchemaField;
+
+/**
+ * Opaque compiled decoding schema
+ *
+ * Immutable once compiled; may be shared between threads.
+ */
+typedef struct GblnSchema GblnSchema;
+
+/**
+ * Opaque reusable parser context
+ *
+ * Retains its token stack, scratch buffers and document arena between
+ * parses, so a long-lived parser reaches a steady state with no allocations.
+ * A parser must not be used from more than one thread at a time.
+ */
+typedef struct GblnParser GblnParser;
+
+/**
+ * Opaque shared key intern table
+ *
+ * Holds one copy of each distinct object key. Keys interned through the same
+ * table share one allocation and compare equal by pointer. Keys are never
+ * removed, so an interned key keeps its address for the table's lifetime.
+ * The table is thread-safe and reference-counted: every parser and object
+ * bound to it keeps it alive.
+ */
+typedef struct GblnKeyTable GblnKeyTable;
+
+/**
+ * Structured error report
+ *
+ * Filled by the `*_err` functions on failure. Filling it allocates nothing;
+ * message and suggestion text are rendered only on request with
+ * `gbln_error_message()` and `gbln_error_suggestion()`.
+ *
+ * The struct is owned by the caller, so unlike `gbln_last_error_message()`
+ * it is never shared between threads. The `*_err` functions that take no
+ * handle (parse, validate, extract, decode and I/O) may therefore be called
+ * from any number of threads at once. Those that operate on a handle
+ * (`GblnParser`, `GblnPushParser`, `GblnReader`, `GblnDoc`) keep that
+ * handle's threading rule: error reporting is per call, not per thread.
+ */
+typedef struct GblnErrorInfo {
+    /**
+     * Error code (same as the function's return value)
+     */
+    enum GblnErrorCode code;
+    /**
+     * Byte offset of the offending token in the input
+     */
+    uintptr_t offset;
+    /**
+     * Byte length of the offending token (0 at end of input)
+     */
+    uintptr_t len;
+    /**
+     * 1-based line of `offset`
+     */
+    uintptr_t line;
+    /**
+     * 1-based column of `offset`, counted in code points
+     */
+    uintptr_t column;
+    /**
+     * OS error number (`errno`) for `GBLN_ERROR_IO`, 0 otherwise
+     */
+    int32_t os_error;
+} GblnErrorInfo;
+
+/**
+ * Parse GBLN string into a value
+ *
+ * # Safety
+ * - `input` must be a valid null-terminated UTF-8 string
+ * - `out_value` must be a valid pointer to store the result
+ * - Caller must free the returned value with `gbln_value_free()`
+ *
+ * # Returns
+ * - `GBLN_OK` on success, with `out_value` set to the parsed value
+ * - Error code on failure, with error details available via `gbln_last_error_message()`
+ */
+enum GblnErrorCode gbln_parse(const char *input, struct GblnValue **out_value);
+
+/**
+ * Parse GBLN string into a value, reporting errors by out-struct
+ *
+ * Same as `gbln_parse()`, but reports failure through `out_error`
+ * instead of the global last-error state.
+ *
+ * # Safety
+ * - `input` must be a valid null-terminated UTF-8 string
+ * - `out_value` must be a valid pointer to store the result
+ * - Caller must free the returned value with `gbln_value_free()`
+ * - `out_error` must be a valid pointer, or NULL to discard error details
+ *
+ * # Returns
+ * - `GBLN_OK` on success, with `out_value` set to the parsed value
+ * - Error code on failure, with `out_error` filled
+ */
+enum GblnErrorCode gbln_parse_err(const char *input,
+                                  struct GblnValue **out_value,
+                                  struct GblnErrorInfo *out_error);
+
+/**
+ * Parse GBLN file into an arena-backed value
+ *
+ * Uncompressed `.gbln` and `.io.gbln` files are memory-mapped (with
+ * `MADV_SEQUENTIAL`) and parsed directly from the mapping; nothing is read
+ * into an intermediate buffer. String values borrow from the mapping, which
+ * stays mapped until the root value is freed. XZ-compressed files are
+ * detected by their magic bytes and decompressed as in `gbln_read_io()`.
+ *
+ * # Safety
+ * - `path` must be a valid null-terminated UTF-8 string
+ * - `out_value` must be a valid pointer to store the result
+ * - The file must not be truncated or modified while the value is alive
+ * - Caller must free the returned root value with `gbln_value_free()`
+ *
+ * # Returns
+ * - `GBLN_OK` on success, with `out_value` set to the parsed value
+ * - `GBLN_ERROR_IO` if the file cannot be opened or mapped
+ * - Parse error code on invalid content
+ * - Error details via `gbln_last_error_message()`
+ */
+enum GblnErrorCode gbln_parse_file(const char *path, struct GblnValue **out_value);
+
+/**
+ * Parse GBLN file into an arena-backed value, reporting errors by out-struct
+ *
+ * Same as `gbln_parse_file()`, but reports failure through `out_error`
+ * instead of the global last-error state.
+ *
+ * # Safety
+ * - `path` must be a valid null-terminated UTF-8 string
+ * - `out_value` must be a valid pointer to store the result
+ * - The file must not be truncated or modified while the value is alive
+ * - Caller must free the returned root value with `gbln_value_free()`
+ * - `out_error` must be a valid pointer, or NULL to discard error details
+ *
+ * # Returns
+ * - `GBLN_OK` on success, with `out_value` set to the parsed value
+ * - Error code on failure, with `out_error` filled
+ */
+enum GblnErrorCode gbln_parse_file_err(const char *path,
+                                       struct GblnValue **out_value,
+                                       struct GblnErrorInfo *out_error);
+
+/**
+ * Validate GBLN in a length-delimited UTF-8 buffer without building a value
+ *
+ * Runs every check `gbln_parse()` runs (syntax, type hint validity, integer
+ * ranges, `sN` string lengths, duplicate keys) but allocates no `GblnValue`
+ * nodes. Only the small per-object key sets needed for duplicate detection
+ * are kept, and only while the object is open.
+ *
+ * # Safety
+ * - `input` must point to at least `len` readable bytes (may be NULL if `len` is 0)
+ *
+ * # Returns
+ * - `GBLN_OK` if the input is a valid GBLN document
+ * - Error code on failure, with error details available via `gbln_last_error_message()`
+ */
+enum GblnErrorCode gbln_validate(const uint8_t *input, uintptr_t len);
+
+/**
+ * Validate GBLN without building a value, reporting errors by out-struct
+ *
+ * Same checks as `gbln_validate()`, but on failure fills `out_error` instead
+ * of recording a last-error message, so rejecting input allocates nothing.
+ *
+ * # Safety
+ * - `input` must point to at least `len` readable bytes (may be NULL if `len` is 0)
+ * - `out_error` must be a valid pointer, or NULL to discard error details
+ *
+ * # Returns
+ * - `GBLN_OK` if the input is valid GBLN
+ * - Error code on failure, with `out_error` filled
+ */
+enum GblnErrorCode gbln_validate_err(const uint8_t *input,
+                                     uintptr_t len,
+                                     struct GblnErrorInfo *out_error);
+
+/**
+ * Extract a single value from GBLN source by path
+ *
+ * Walks the input once and materialises only the addressed value. Sibling
+ * subtrees are skipped structurally without being decoded or validated,
+ * and scanning stops as soon as the value has been read.
+ *
+ * # Path Syntax
+ * Segments separated by `.`, outermost first, e.g. `response.data.user.id`.
+ * Each segment is resolved against the container it is applied to: in an
+ * object it is a key (so a key made of digits is still a key), in an array
+ * it must be a decimal index, e.g. `users.0.name`. A `.` or `\` inside a key
+ * is written `\.` or `\\`. An empty path addresses the whole document.
+ * This matches path lookup on on-demand documents.
+ *
+ * # Safety
+ * - `input` must point to at least `len` readable bytes (may be NULL if `len` is 0)
+ * - `path` must be a valid null-terminated UTF-8 string
+ * - `out_value` must be a valid pointer to store the result
+ * - Caller must free a non-NULL result with `gbln_value_free()`
+ *
+ * # Returns
+ * - `GBLN_OK` on success, with `out_value` set to the extracted value,
+ *   or to NULL if the path does not exist
+ * - Error code if the input up to and including the addressed value is invalid,
+ *   with error details available via `gbln_last_error_message()`
+ */
+enum GblnErrorCode gbln_extract(const uint8_t *input,
+                                uintptr_t len,
+                                const char *path,
+                                struct GblnValue **out_value);
+
+/**
+ * Extract a single value by path, reporting errors by out-struct
+ *
+ * Same as `gbln_extract()`, but reports failure through `out_error`
+ * instead of the global last-error state.
+ *
+ * # Safety
+ * - `input` must point to at least `len` readable bytes (may be NULL if `len` is 0)
+ * - `path` must be a valid null-terminated UTF-8 string
+ * - `out_value` must be a valid pointer to store the result
+ * - Caller must free a non-NULL returned value with `gbln_value_free()`
+ * - `out_error` must be a valid pointer, or NULL to discard error details
+ *
+ * # Returns
+ * - `GBLN_OK` on success, with `out_value` set to the value, or NULL if the path does not exist
+ * - Error code on failure, with `out_error` filled
+ */
+enum GblnErrorCode gbln_extract_err(const uint8_t *input,
+                                    uintptr_t len,
+                                    const char *path,
+                                    struct GblnValue **out_value,
+                                    struct GblnErrorInfo *out_error);
+
+/**
+ * Compile a decoding schema
+ *
+ * Builds a key-dispatch table from the field descriptions. Path strings are
+ * copied; the `fields` array may be freed after this call.
+ *
+ * # Safety
+ * - `fields` must point to `count` valid GblnSchemaField entries
+ * - `out_schema` must be a valid pointer to store the result
+ * - Caller must free the returned schema with `gbln_schema_free()`
+ *
+ * # Returns
+ * - `GBLN_OK` on success
+ * - `GBLN_ERROR_INVALID_TYPE_HINT` if a field type is not a scalar type,
+ *   or a `Str` field has a capacity of 0
+ * - `GBLN_ERROR_DUPLICATE_KEY` if two fields share a path
+ */
+enum GblnErrorCode gbln_schema_compile(const struct GblnSchemaField *fields,
+                                       uintptr_t count,
+                                       struct GblnSchema **out_schema);
+
+/**
+ * Decode a GBLN document directly into a native struct
+ *
+ * Parses the input against a compiled schema and writes each field straight
+ * into `out_struct`; no `GblnValue` tree is built. Values not described by
+ * the schema are validated but otherwise skipped.
+ *
+ * # Safety
+ * - `schema` must be a valid GblnSchema pointer
+ * - `input` must point to at least `len` readable bytes (may be NULL if `len` is 0)
+ * - `out_struct` must point to writable memory covering every field's offset and size
+ *
+ * # Returns
+ * - `GBLN_OK` on success
+ * - `GBLN_ERROR_MISSING_FIELD` if a required field is absent
+ * - `GBLN_ERROR_TYPE_MISMATCH` if a field's type hint differs from the schema
+ * - `GBLN_ERROR_STRING_TOO_LONG` if a string does not fit its field's capacity
+ * - Parse error code on invalid input
+ * - Error details available via `gbln_last_error_message()`; on failure the
+ *   contents of `out_struct` are unspecified
+ */
+enum GblnErrorCode gbln_decode_into(const struct GblnSchema *schema,
+                                    const uint8_t *input,
+                                    uintptr_t len,
+                                    void *out_struct);
+
+/**
+ * Decode a GBLN document into a native struct, reporting errors by out-struct
+ *
+ * Same as `gbln_decode_into()`, but reports failure through `out_error`
+ * instead of the global last-error state.
+ *
+ * # Safety
+ * - Same requirements as `gbln_decode_into()`
+ * - `out_error` must be a valid pointer, or NULL to discard error details
+ *
+ * # Returns
+ * - `GBLN_OK` on success
+ * - Error code on failure, with `out_error` filled; the contents of
+ *   `out_struct` are unspecified
+ */
+enum GblnErrorCode gbln_decode_into_err(const struct GblnSchema *schema,
+                                        const uint8_t *input,
+                                        uintptr_t len,
+                                        void *out_struct,
+                                        struct GblnErrorInfo *out_error);
+
+/**
+ * Free decoding schema
+ *
+ * # Safety
+ * - `schema` must be a valid pointer from `gbln_schema_compile()` or NULL
+ * - Must not be called twice on the same pointer
+ */
+void gbln_schema_free(struct GblnSchema *schema);
+
+/**
+ * Parse GBLN from a length-delimited UTF-8 buffer into an arena-backed value
+ *
+ * The input does not need to be null-terminated, so callers can parse
+ * directly out of socket or file buffers without copying them into a C
+ * string first. Every node, key and string of the resulting tree is
+ * bump-allocated from a single arena owned by the root value. `gbln_value_free()` on the root
+ * releases the whole document at once instead of walking the tree.
+ *
+ * Arena documents are read-only: `gbln_object_insert()` and
+ * `gbln_array_push()` on any of their values return `GBLN_ERROR_TYPE_MISMATCH`.
+ *
+ * # Safety
+ * - `input` must point to at least `len` readable bytes (may be NULL if `len` is 0)
+ * - `out_value` must be a valid pointer to store the result
+ * - Caller must free the returned root value with `gbln_value_free()`
+ * - Child values must NOT be freed individually
+ *
+ * # Returns
+ * - `GBLN_OK` on success, with `out_value` set to the parsed value
+ * - Error code on failure, with error details available via `gbln_last_error_message()`
+ */
+enum GblnErrorCode gbln_parse_arena(const uint8_t *input,
+                                    uintptr_t len,
+                                    struct GblnValue **out_value);
+
+/**
+ * Parse GBLN into an arena-backed value, reporting errors by out-struct
+ *
+ * Same as `gbln_parse_arena()`, including MINI detection, but reports
+ * failure through `out_error` instead of the global last-error state.
+ *
+ * # Safety
+ * - `input` must point to at least `len` readable bytes (may be NULL if `len` is 0)
+ * - `out_value` must be a valid pointer to store the result
+ * - `out_error` must be a valid pointer, or NULL to discard error details
+ * - Caller must free the returned root value with `gbln_value_free()`
+ *
+ * # Returns
+ * - `GBLN_OK` on success, with `out_value` set to the parsed value
+ * - Error code on failure, with `out_error` filled
+ */
+enum GblnErrorCode gbln_parse_arena_err(const uint8_t *input,
+                                        uintptr_t len,
+                                        struct GblnValue **out_value,
+                                        struct GblnErrorInfo *out_error);
+
+/**
+ * Parse MINI GBLN into an arena-backed value, reporting errors by out-struct
+ *
+ * MINI GBLN (as written with `mini_mode` and `strip_comments`) has no
+ * whitespace between tokens and no `:|` comments. This specialised parser
+ * drops whitespace skipping and comment handling from its inner loops;
+ * whitespace is only accepted inside string values and between array
+ * elements, where MINI output uses a single space as separator.
+ *
+ * `gbln_parse_arena()`, `gbln_parse_file()`, `gbln_read_io()` and their
+ * `_err` variants select this parser automatically when the structural
+ * pre-scan finds no other whitespace or comments, so calling it directly
+ * only skips that check.
+ *
+ * # Safety
+ * - `input` must point to at least `len` readable bytes (may be NULL if `len` is 0)
+ * - `out_value` must be a valid pointer to store the result
+ * - `out_error` must be a valid pointer, or NULL to discard error details
+ * - Caller must free the returned root value with `gbln_value_free()`
+ *
+ * # Returns
+ * - `GBLN_OK` on success, with `out_value` set to the parsed value
+ * - `GBLN_ERROR_UNEXPECTED_CHAR` at the first whitespace or comment that
+ *   MINI GBLN does not allow, with `out_error` filled
+ * - Other error code on failure, with `out_error` filled
+ */
+enum GblnErrorCode gbln_parse_mini_err(const uint8_t *input,
+                                       uintptr_t len,
+                                       struct GblnValue **out_value,
+                                       struct GblnErrorInfo *out_error);
+
+/**
+ * Parse GBLN from a length-delimited UTF-8 buffer on multiple threads
+ *
+ * A structural pre-scan splits a large top-level array or object (or the
+ * single keyed array/object of a document such as `records[...]`) at element
+ * boundaries. The pieces are parsed in parallel and stitched into one value
+ * tree in document order. Inputs too small to benefit, or without a splittable
+ * top level, are parsed on the calling thread.
+ *
+ * # Parameters
+ * - nthreads: Maximum number of worker threads (0 = one per available core)
+ *
+ * # Safety
+ * - `input` must point to at least `len` readable bytes (may be NULL if `len` is 0)
+ * - `out_value` must be a valid pointer to store the result
+ * - Caller must free the returned value with `gbln_value_free()`
+ *
+ * # Returns
+ * - `GBLN_OK` on success, with `out_value` set to the parsed value
+ * - Error code on failure, with details of the first error in document order
+ *   available via `gbln_last_error_message()`
+ */
+enum GblnErrorCode gbln_parse_parallel(const uint8_t *input,
+                                       uintptr_t len,
+                                       uintptr_t nthreads,
+                                       struct GblnValue **out_value);
+
+/**
+ * Parse GBLN on multiple threads, reporting errors by out-struct
+ *
+ * Same as `gbln_parse_parallel()`, but reports failure through `out_error`
+ * instead of the global last-error state.
+ *
+ * When several chunks fail, `out_error` reports the one earliest in the input.
+ *
+ * # Safety
+ * - `input` must point to at least `len` readable bytes (may be NULL if `len` is 0)
+ * - `out_value` must be a valid pointer to store the result
+ * - Caller must free the returned value with `gbln_value_free()`
+ * - `out_error` must be a valid pointer, or NULL to discard error details
+ *
+ * # Returns
+ * - `GBLN_OK` on success, with `out_value` set to the parsed value
+ * - Error code on failure, with `out_error` filled
+ */
+enum GblnErrorCode gbln_parse_parallel_err(const uint8_t *input,
+                                           uintptr_t len,
+                                           uintptr_t nthreads,
+                                           struct GblnValue **out_value,
+                                           struct GblnErrorInfo *out_error);
+
+/**
+ * Parse a GBLN record stream into an array of values
+ *
+ * A record stream holds many top-level documents, each written in MINI
+ * GBLN (as produced by `gbln_to_string()`) and terminated by a line feed
+ * (`\n`). A final record without a trailing line feed is accepted, and
+ * empty lines are skipped. Records are parsed in parallel across a worker
+ * pool and returned in stream order.
+ *
+ * Framing is by raw line feed only, and MINI GBLN does not escape line
+ * feeds inside string values, so a record must not contain any. A record
+ * cut off inside a string value at a line feed fails with
+ * `GBLN_ERROR_UNTERMINATED_STRING`, and the error message names the line
+ * feed as the cause.
+ *
+ * # Parameters
+ * - nthreads: Maximum number of worker threads (0 = one per available core)
+ *
+ * # Safety
+ * - `input` must point to at least `len` readable bytes (may be NULL if `len` is 0)
+ * - `out_values` must be a valid pointer to store the array of values
+ * - `out_count` must be a valid pointer to store the number of values
+ * - Caller must free the returned array with `gbln_values_free()`
+ *
+ * # Returns
+ * - `GBLN_OK` on success (an empty stream yields a count of 0); every one
+ *   of the `*out_count` slots holds a non-NULL root value, in stream order
+ * - Error code of the first invalid record on failure, with its record
+ *   number available via `gbln_last_error_message()`; nothing is returned
+ */
+enum GblnErrorCode gbln_parse_stream_batch(const uint8_t *input,
+                                           uintptr_t len,
+                                           uintptr_t nthreads,
+                                           struct GblnValue ***out_values,
+                                           uintptr_t *out_count);
+
+/**
+ * Parse a record stream on multiple threads, reporting errors by out-struct
+ *
+ * Same as `gbln_parse_stream_batch()`, but reports failure through `out_error`
+ * instead of the global last-error state.
+ *
+ * Offsets, lines and columns in `out_error` refer to the whole stream,
+ * not to the failing record.
+ *
+ * # Safety
+ * - `input` must point to at least `len` readable bytes (may be NULL if `len` is 0)
+ * - `out_values` and `out_count` must be valid pointers
+ * - Caller must free the returned array with `gbln_values_free()`
+ * - `out_error` must be a valid pointer, or NULL to discard error details
+ *
+ * # Returns
+ * - `GBLN_OK` on success, with `out_values` and `out_count` set
+ * - Error code on failure, with `out_error` filled
+ */
+enum GblnErrorCode gbln_parse_stream_batch_err(const uint8_t *input,
+                                               uintptr_t len,
+                                               uintptr_t nthreads,
+                                               struct GblnValue ***out_values,
+                                               uintptr_t *out_count,
+                                               struct GblnErrorInfo *out_error);
+
+/**
+ * Free values array
+ *
+ * Frees every value and the array returned by `gbln_parse_stream_batch()`.
+ *
+ * # Safety
+ * - `values` must be a valid pointer returned from `gbln_parse_stream_batch()` or NULL
+ * - `count` must be the count returned with it
+ * - Must not be called twice on the same pointer
+ */
+void gbln_values_free(struct GblnValue **values, uintptr_t count);
+
+/**
+ * Get structural scanner backend
+ *
+ * Returns the stage-1 scanner selected for this CPU.
+ */
+enum GblnScannerBackend gbln_scanner_backend(void);
+
+/**
+ * Create reusable parser context
+ *
+ * # Safety
+ * Caller must free with `gbln_parser_free()`
+ */
+struct GblnParser *gbln_parser_new(void);
+
+/**
+ * Free parser context
+ *
+ * Invalidates any document still owned by the parser.
+ *
+ * # Safety
+ * - `parser` must be a valid pointer from `gbln_parser_new()` or NULL
+ * - Must not be called twice on the same pointer
+ */
+void gbln_parser_free(struct GblnParser *parser);
+
+/**
+ * Parse GBLN from a length-delimited UTF-8 buffer using a parser context
+ *
+ * The document is built in the parser's arena. Any document from a previous
+ * call is invalidated first, and its memory is reused.
+ *
+ * # Safety
+ * - `parser` must be a valid GblnParser pointer
+ * - `input` must point to at least `len` readable bytes (may be NULL if `len` is 0)
+ * - `out_value` must be a valid pointer to store the result
+ * - Returned value is owned by the parser and is valid until the next
+ *   `gbln_parser_parse()`, `gbln_parser_reset()` or `gbln_parser_free()` call
+ * - Caller must NOT free the returned value with `gbln_value_free()`
+ *
+ * # Returns
+ * - `GBLN_OK` on success, with `out_value` set to the parsed value
+ * - Error code on failure, with error details available via `gbln_last_error_message()`
+ */
+enum GblnErrorCode gbln_parser_parse(struct GblnParser *parser,
+                                     const uint8_t *input,
+                                     uintptr_t len,
+                                     struct GblnValue **out_value);
+
+/**
+ * Parse GBLN using a parser context, reporting errors by out-struct
+ *
+ * Same as `gbln_parser_parse()`, but reports failure through `out_error`.
+ * The parser is still single-thread-confined (see `GblnErrorInfo`).
+ *
+ * # Safety
+ * - Same requirements as `gbln_parser_parse()`
+ * - `out_error` must be a valid pointer, or NULL to discard error details
+ *
+ * # Returns
+ * - `GBLN_OK` on success, with `out_value` set to the parsed value
+ * - Error code on failure, with `out_error` filled
+ */
+enum GblnErrorCode gbln_parser_parse_err(struct GblnParser *parser,
+                                         const uint8_t *input,
+                                         uintptr_t len,
+                                         struct GblnValue **out_value,
+                                         struct GblnErrorInfo *out_error);
+
+/**
+ * Reset parser context
+ *
+ * Invalidates the current document but keeps all buffers for reuse.
+ *
+ * # Safety
+ * - `parser` must be a valid GblnParser pointer
+ */
+void gbln_parser_reset(struct GblnParser *parser);
+
+/**
+ * Create shared key intern table
+ *
+ * # Safety
+ * Caller must release with `gbln_key_table_free()`
+ */
+struct GblnKeyTable *gbln_key_table_new(void);
+
+/**
+ * Release caller's reference to a key intern table
+ *
+ * The table is destroyed once no parser or object is bound to it any more.
+ *
+ * # Safety
+ * - `table` must be a valid pointer from `gbln_key_table_new()` or NULL
+ * - Must not be called twice on the same pointer
+ */
+void gbln_key_table_free(struct GblnKeyTable *table);
+
+/**
+ * Get number of distinct keys interned in a table
+ *
+ * # Safety
+ * - `table` must be a valid GblnKeyTable pointer
+ */
+uintptr_t gbln_key_table_len(const struct GblnKeyTable *table);
+
+/**
+ * Bind parser context to a key intern table
+ *
+ * Object keys of every document the parser builds from now on are interned
+ * in `table` instead of being copied into the parser's arena. Several
+ * parsers on different threads may share one table.
+ *
+ * # Safety
+ * - `parser` must be a valid GblnParser pointer
+ * - `table` must be a valid GblnKeyTable pointer, or NULL to unbind
+ *
+ * # Returns
+ * - `GBLN_OK` on success
+ * - `GBLN_ERROR_NULL_POINTER` if `parser` is NULL
+ */
+enum GblnErrorCode gbln_parser_set_key_table(struct GblnParser *parser,
+                                             struct GblnKeyTable *table);
+
+/**
+ * Create incremental push parser
+ *
+ * # Safety
+ * - `callback` must be a valid function pointer
+ * - `user_data` is passed through to `callback` unchanged and may be NULL
+ * - Caller must free with `gbln_push_free()`
+ */
+struct GblnPushParser *gbln_push_new(GblnEventCallback callback, void *user_data);
+
+/**
+ * Feed a chunk of input to a push parser
+ *
+ * Chunks may split tokens, including multi-byte UTF-8 sequences, at any byte.
+ *
+ * # Safety
+ * - `ctx` must be a valid GblnPushParser pointer
+ * - `buf` must point to at least `len` readable bytes (may be NULL if `len` is 0)
+ *
+ * # Returns
+ * - `GBLN_OK` if the chunk was consumed
+ * - `GBLN_ERROR_CALLBACK_ABORTED` if the callback stopped parsing
+ * - Parse error code on invalid input, with details via `gbln_last_error_message()`
+ */
+enum GblnErrorCode gbln_push_feed(struct GblnPushParser *ctx, const uint8_t *buf, uintptr_t len);
+
+/**
+ * Feed a chunk of input to a push parser, reporting errors by out-struct
+ *
+ * Same as `gbln_push_feed()`, but reports failure through `out_error`. The
+ * push parser is still single-thread-confined (see `GblnErrorInfo`). The
+ * reported offset, line and column count from the first byte fed, not from
+ * the start of `buf`.
+ *
+ * # Safety
+ * - Same requirements as `gbln_push_feed()`
+ * - `out_error` must be a valid pointer, or NULL to discard error details
+ *
+ * # Returns
+ * - `GBLN_OK` if the chunk was consumed
+ * - `GBLN_ERROR_CALLBACK_ABORTED` if the callback stopped parsing
+ * - Parse error code on invalid input, with `out_error` filled
+ */
+enum GblnErrorCode gbln_push_feed_err(struct GblnPushParser *ctx,
+                                      const uint8_t *buf,
+                                      uintptr_t len,
+                                      struct GblnErrorInfo *out_error);
+
+/**
+ * Signal end of input to a push parser
+ *
+ * Flushes the final token and checks that every object and array was closed.
+ *
+ * # Safety
+ * - `ctx` must be a valid GblnPushParser pointer
+ *
+ * # Returns
+ * - `GBLN_OK` if the input formed a complete document
+ * - `GBLN_ERROR_UNEXPECTED_EOF` if the input ended mid-document
+ */
+enum GblnErrorCode gbln_push_finish(struct GblnPushParser *ctx);
+
+/**
+ * Signal end of input to a push parser, reporting errors by out-struct
+ *
+ * Same conventions as `gbln_push_feed_err()`.
+ *
+ * # Returns
+ * - `GBLN_OK` if the input formed a complete document
+ * - `GBLN_ERROR_UNEXPECTED_EOF` if the input ended mid-document, with `out_error` filled
+ */
+enum GblnErrorCode gbln_push_finish_err(struct GblnPushParser *ctx, struct GblnErrorInfo *out_error);
+
+/**
+ * Free push parser
+ *
+ * # Safety
+ * - `ctx` must be a valid pointer from `gbln_push_new()` or NULL
+ * - Must not be called twice on the same pointer
+ */
+void gbln_push_free(struct GblnPushParser *ctx);
+
+/**
+ * Create event reader over a byte buffer
+ *
+ * # Safety
+ * - `input` must point to at least `len` readable bytes (may be NULL if `len` is 0)
+ * - `input` is borrowed and must stay valid and unmodified until `gbln_reader_free()`
+ * - Caller must free with `gbln_reader_free()`
+ */
+struct GblnReader *gbln_reader_new_buffer(const uint8_t *input, uintptr_t len);
+
+/**
+ * Create event reader over a file descriptor
+ *
+ * Reads the descriptor in fixed-size blocks as events are requested.
+ * The descriptor is not closed by the reader.
+ *
+ * Only uncompressed input is supported. If the stream starts with the XZ
+ * magic bytes (FD 37 7A 58 5A 00), the first `gbln_reader_next()` fails with
+ * `GBLN_ERROR_IO` (and `os_error` 0 from `gbln_reader_next_err()`); read
+ * such files with `gbln_read_io()` instead. The descriptor is never
+ * seeked, so pipes and terminals are supported.
+ *
+ * # Safety
+ * - `fd` must be a readable file descriptor that stays open until `gbln_reader_free()`
+ * - Caller must free with `gbln_reader_free()`
+ */
+struct GblnReader *gbln_reader_new_fd(int fd);
+
+/**
+ * Read next event
+ *
+ * # Safety
+ * - `reader` must be a valid GblnReader pointer
+ * - `out_event` must be a valid pointer to store the event
+ * - `out_has_event` must be a valid pointer; set to false at end of input
+ * - Pointers in the event are valid until the next `gbln_reader_next()` call
+ *
+ * # Returns
+ * - `GBLN_OK` on success, with `out_event` set if `out_has_event` is true
+ * - `GBLN_ERROR_IO` if reading the file descriptor fails
+ * - Parse error code on invalid input, with details via `gbln_last_error_message()`
+ */
+enum GblnErrorCode gbln_reader_next(struct GblnReader *reader,
+                                    struct GblnEvent *out_event,
+                                    bool *out_has_event);
+
+/**
+ * Read next event, reporting errors by out-struct
+ *
+ * Same as `gbln_reader_next()`, but reports failure through `out_error`. The
+ * reader is still single-thread-confined (see `GblnErrorInfo`). For a buffer
+ * reader the reported offset is into that buffer; for a descriptor reader it
+ * counts from the first byte read.
+ *
+ * # Safety
+ * - Same requirements as `gbln_reader_next()`
+ * - `out_error` must be a valid pointer, or NULL to discard error details
+ *
+ * # Returns
+ * - `GBLN_OK` on success, with `out_event` set if `out_has_event` is true
+ * - `GBLN_ERROR_IO` if reading the file descriptor fails, with `out_error`
+ *   filled including `os_error`
+ * - Parse error code on invalid input, with `out_error` filled
+ */
+enum GblnErrorCode gbln_reader_next_err(struct GblnReader *reader,
+                                        struct GblnEvent *out_event,
+                                        bool *out_has_event,
+                                        struct GblnErrorInfo *out_error);
+
+/**
+ * Free event reader
+ *
+ * # Safety
+ * - `reader` must be a valid pointer from `gbln_reader_new_*()` or NULL
+ * - Must not be called twice on the same pointer
+ */
+void gbln_reader_free(struct GblnReader *reader);
+
+/**
+ * Open GBLN buffer as an on-demand document
+ *
+ * Scans the input once and records structure on a tape. Syntax errors are
+ * reported here; type-bound errors (integer range, string length) are
+ * detected only when the offending value is decoded, see `gbln_doc_error()`.
+ *
+ * # Safety
+ * - `input` must point to at least `len` readable bytes (may be NULL if `len` is 0)
+ * - `input` is borrowed and must stay valid and unmodified until `gbln_doc_free()`
+ * - `out_doc` must be a valid pointer to store the result
+ * - Caller must free the returned document with `gbln_doc_free()`
+ *
+ * # Returns
+ * - `GBLN_OK` on success, with `out_doc` set to the opened document
+ * - Error code on failure, with error details available via `gbln_last_error_message()`
+ */
+enum GblnErrorCode gbln_doc_open(const uint8_t *input, uintptr_t len, struct GblnDoc **out_doc);
+
+/**
+ * Open GBLN buffer as an on-demand document, reporting errors by out-struct
+ *
+ * Same as `gbln_doc_open()`, but reports failure through `out_error`
+ * instead of the global last-error state.
+ *
+ * # Safety
+ * - Same requirements as `gbln_doc_open()`
+ * - `out_error` must be a valid pointer, or NULL to discard error details
+ *
+ * # Returns
+ * - `GBLN_OK` on success, with `out_doc` set to the opened document
+ * - Error code on failure, with `out_error` filled
+ */
+enum GblnErrorCode gbln_doc_open_err(const uint8_t *input,
+                                     uintptr_t len,
+                                     struct GblnDoc **out_doc,
+                                     struct GblnErrorInfo *out_error);
+
+/**
+ * Open GBLN file as an on-demand document
+ *
+ * Memory-maps the file (with `MADV_SEQUENTIAL` for the initial scan) and
+ * records the tape over the mapping. The document owns the mapping and
+ * unmaps it in `gbln_doc_free()`. Compressed files are not supported.
+ *
+ * # Safety
+ * - `path` must be a valid null-terminated UTF-8 string
+ * - `out_doc` must be a valid pointer to store the result
+ * - The file must not be truncated or modified while the document is alive
+ * - Caller must free the returned document with `gbln_doc_free()`
+ *
+ * # Returns
+ * - `GBLN_OK` on success, with `out_doc` set to the opened document
+ * - `GBLN_ERROR_IO` if the file cannot be opened or mapped, or is compressed
+ * - Parse error code on invalid syntax
+ * - Error details via `gbln_last_error_message()`
+ */
+enum GblnErrorCode gbln_doc_open_file(const char *path, struct GblnDoc **out_doc);
+
+/**
+ * Open GBLN file as an on-demand document, reporting errors by out-struct
  *
- * Represents the type of a GBLN value.
- * This allows C code to query the type without trying every accessor.
+ * Same conventions as `gbln_doc_open_err()`.
+ *
+ * # Returns
+ * - `GBLN_OK` on success, with `out_doc` set to the opened document
+ * - `GBLN_ERROR_IO` if the file cannot be opened or mapped, or is compressed,
+ *   with `out_error` filled including `os_error`
+ * - Parse error code on invalid syntax, with `out_error` filled
  */
-typedef enum GblnValueType {
-    I8 = 0,
-    I16 = 1,
-    I32 = 2,
-    I64 = 3,
-    U8 = 4,
-    U16 = 5,
-    U32 = 6,
-    U64 = 7,
-    F32 = 8,
-    F64 = 9,
-    Str = 10,
-    Bool = 11,
-    Null = 12,
-    Object = 13,
-    Array = 14,
-} GblnValueType;
+enum GblnErrorCode gbln_doc_open_file_err(const char *path,
+                                          struct GblnDoc **out_doc,
+                                          struct GblnErrorInfo *out_error);
 
 /**
- * Opaque pointer to a GBLN value
+ * Get root value of an on-demand document
  *
- * This is a C-compatible wrapper around Rust's Value type.
- * C code sees this as an opaque pointer and must use the provided
- * accessor functions to interact with it.
+ * The returned value works with every read accessor. Children are decoded
+ * from the tape on first access and cached in the document.
  *
- * Note: This struct is intentionally opaque to C. The internal
- * Value type is not exposed in the C header.
+ * # Safety
+ * - `doc` must be a valid GblnDoc pointer
+ * - Returned pointer is valid as long as the document is valid
+ * - Caller must NOT free the returned value with `gbln_value_free()`
  */
-typedef struct GblnValue GblnValue;
+const struct GblnValue *gbln_doc_root(const struct GblnDoc *doc);
 
 /**
- * Opaque wrapper for GblnConfig
+ * Get first deferred decoding error of an on-demand document
+ *
+ * Returns `GBLN_OK` if every value decoded so far is valid. Otherwise returns
+ * the error of the first invalid value reached, with details available via
+ * `gbln_last_error_message()`. Accessors return NULL / `ok = false` for
+ * invalid values.
+ *
+ * # Safety
+ * - `doc` must be a valid GblnDoc pointer
  */
-typedef struct GblnConfig GblnConfig;
+enum GblnErrorCode gbln_doc_error(const struct GblnDoc *doc);
 
 /**
- * Parse GBLN string into a value
+ * Get first deferred decoding error of an on-demand document as an out-struct
+ *
+ * Same as `gbln_doc_error()`, but fills `out_error` for the first invalid
+ * value instead of pointing to the last-error message. The reported offset
+ * is into the document's input.
  *
  * # Safety
- * - `input` must be a valid null-terminated UTF-8 string
- * - `out_value` must be a valid pointer to store the result
- * - Caller must free the returned value with `gbln_value_free()`
+ * - `doc` must be a valid GblnDoc pointer
+ * - `out_error` must be a valid pointer, or NULL to discard error details
  *
  * # Returns
- * - `GBLN_OK` on success, with `out_value` set to the parsed value
- * - Error code on failure, with error details available via `gbln_last_error_message()`
+ * - `GBLN_OK` if every value decoded so far is valid
+ * - Error code of the first invalid value, with `out_error` filled
  */
-enum GblnErrorCode gbln_parse(const char *input, struct GblnValue **out_value);
+enum GblnErrorCode gbln_doc_error_err(const struct GblnDoc *doc, struct GblnErrorInfo *out_error);
+
+/**
+ * Free on-demand document
+ *
+ * # Safety
+ * - `doc` must be a valid pointer from `gbln_doc_open()` or NULL
+ * - Must not be called twice on the same pointer
+ */
+void gbln_doc_free(struct GblnDoc *doc);
 
 /**
  * Free a GBLN value
  *
+ * For arena-backed roots this releases the whole document in O(1).
+ *
  * # Safety
- * - `value` must be a valid pointer returned from `gbln_parse()` or NULL
+ * - `value` must be NULL, a root value returned by a `gbln_parse*()`,
+ *   `gbln_extract*()` or `gbln_read_io*()` call, or a value created by a
+ *   `gbln_value_new_*()` function that has not been inserted into another value
+ * - Calling it on a non-root node of an arena-backed document (any child of
+ *   such a root) is invalid
+ * - Values owned by a parser (`gbln_parser_parse()`), a document
+ *   (`gbln_doc_root()`) or a record batch (`gbln_values_free()`) must not be
+ *   passed here
  * - Must not be called twice on the same pointer
  */
 void gbln_value_free(struct GblnValue *value);
@@ -131,6 +1206,9 @@ void gbln_string_free(char *s);
 /**
  * Get last error message
  *
+ * The last error is process-wide: concurrent callers may read each other's
+ * errors. Multi-threaded callers should use the `*_err` variants instead.
+ *
  * Returns NULL if no error occurred.
  * The returned pointer is valid until the next error occurs.
  * Caller must free with `gbln_string_free()`.
@@ -146,9 +1224,52 @@ char *gbln_last_error_message(void);
  */
 char *gbln_last_error_suggestion(void);
 
+/**
+ * Render the message for a structured error
+ *
+ * Writes a null-terminated message, including line and column, into `buf`,
+ * truncating if it does not fit. When the input that produced the error is
+ * passed, the message quotes the offending token.
+ *
+ * # Safety
+ * - `error` must point to a `GblnErrorInfo` filled by a `*_err` function
+ * - `input` must be the same buffer the error was reported for, or NULL;
+ *   only the token at `error->offset` is read, so a copy of just the token
+ *   may be passed instead with `offset` set to 0
+ * - `buf` must point to at least `buf_len` writable bytes (may be NULL if `buf_len` is 0)
+ *
+ * # Returns
+ * - Length of the full message in bytes, excluding the null terminator;
+ *   a result `>= buf_len` means the message was truncated
+ */
+uintptr_t gbln_error_message(const struct GblnErrorInfo *error,
+                             const uint8_t *input,
+                             uintptr_t input_len,
+                             char *buf,
+                             uintptr_t buf_len);
+
+/**
+ * Render the suggestion for a structured error
+ *
+ * Same conventions as `gbln_error_message()`.
+ *
+ * # Returns
+ * - Length of the full suggestion in bytes, excluding the null terminator;
+ *   0 if no suggestion is available
+ */
+uintptr_t gbln_error_suggestion(const struct GblnErrorInfo *error,
+                                const uint8_t *input,
+                                uintptr_t input_len,
+                                char *buf,
+                                uintptr_t buf_len);
+
 /**
  * Get field from object
  *
+ * Objects with more than `GBLN_OBJECT_INDEX_THRESHOLD` fields carry a hash
+ * index that is built lazily on first lookup, so lookups on wide objects
+ * take O(1) on average. Smaller objects are scanned linearly.
+ *
  * # Safety
  * - `value` must be a valid GblnValue pointer
  * - `key` must be a valid null-terminated UTF-8 string
@@ -176,6 +1297,227 @@ uintptr_t gbln_array_len(const struct GblnValue *value);
  */
 const struct GblnValue *gbln_array_get(const struct GblnValue *value, uintptr_t index);
 
+/**
+ * Get element type of a packed scalar array
+ *
+ * Arrays whose type hint is a numeric or boolean type (`<i32>[1 2 3]`,
+ * `samples<f64>[...]`, `flags<b>[t f]`) are stored as one packed native
+ * buffer rather than one `GblnValue` per element. Their elements can be
+ * read directly through the `gbln_array_as_*_slice()` functions.
+ * `gbln_array_get()` still works on packed arrays; element values are
+ * materialised on its first call.
+ *
+ * # Safety
+ * - `value` must be a valid GblnValue pointer
+ *
+ * # Returns
+ * - Element type of a packed array
+ * - `Null` if value is not an array or is not packed (untyped, string-typed,
+ *   or built with `gbln_array_push()`)
+ */
+enum GblnValueType gbln_array_element_type(const struct GblnValue *value);
+
+/**
+ * Get packed i8 array elements
+ *
+ * # Safety
+ * - `value` must be a valid GblnValue pointer
+ * - `out_len` must be a valid pointer to store the element count
+ * - Returned pointer is valid as long as the array is valid
+ *
+ * # Returns
+ * - Pointer to `*out_len` contiguous elements (non-NULL even for an empty array)
+ * - NULL with `*out_len` set to 0 if value is not a packed i8 array; elements
+ *   are never converted (use `gbln_array_copy_i8()` and siblings for that)
+ */
+const int8_t *gbln_array_as_i8_slice(const struct GblnValue *value, uintptr_t *out_len);
+
+/**
+ * Get packed i16 array elements
+ *
+ * Same safety requirements and results as `gbln_array_as_i8_slice()`.
+ */
+const int16_t *gbln_array_as_i16_slice(const struct GblnValue *value, uintptr_t *out_len);
+
+/**
+ * Get packed i32 array elements
+ *
+ * Same safety requirements and results as `gbln_array_as_i8_slice()`.
+ */
+const int32_t *gbln_array_as_i32_slice(const struct GblnValue *value, uintptr_t *out_len);
+
+/**
+ * Get packed i64 array elements
+ *
+ * Same safety requirements and results as `gbln_array_as_i8_slice()`.
+ */
+const int64_t *gbln_array_as_i64_slice(const struct GblnValue *value, uintptr_t *out_len);
+
+/**
+ * Get packed u8 array elements
+ *
+ * Same safety requirements and results as `gbln_array_as_i8_slice()`.
+ */
+const uint8_t *gbln_array_as_u8_slice(const struct GblnValue *value, uintptr_t *out_len);
+
+/**
+ * Get packed u16 array elements
+ *
+ * Same safety requirements and results as `gbln_array_as_i8_slice()`.
+ */
+const uint16_t *gbln_array_as_u16_slice(const struct GblnValue *value, uintptr_t *out_len);
+
+/**
+ * Get packed u32 array elements
+ *
+ * Same safety requirements and results as `gbln_array_as_i8_slice()`.
+ */
+const uint32_t *gbln_array_as_u32_slice(const struct GblnValue *value, uintptr_t *out_len);
+
+/**
+ * Get packed u64 array elements
+ *
+ * Same safety requirements and results as `gbln_array_as_i8_slice()`.
+ */
+const uint64_t *gbln_array_as_u64_slice(const struct GblnValue *value, uintptr_t *out_len);
+
+/**
+ * Get packed f32 array elements
+ *
+ * Same safety requirements and results as `gbln_array_as_i8_slice()`.
+ */
+const float *gbln_array_as_f32_slice(const struct GblnValue *value, uintptr_t *out_len);
+
+/**
+ * Get packed f64 array elements
+ *
+ * Same safety requirements and results as `gbln_array_as_i8_slice()`.
+ */
+const double *gbln_array_as_f64_slice(const struct GblnValue *value, uintptr_t *out_len);
+
+/**
+ * Get packed bool array elements
+ *
+ * Same safety requirements and results as `gbln_array_as_i8_slice()`.
+ */
+const bool *gbln_array_as_bool_slice(const struct GblnValue *value, uintptr_t *out_len);
+
+/**
+ * Copy array elements as i8
+ *
+ * The `gbln_array_copy_*()` functions convert the first `n` elements of any
+ * array, packed or not, in one call. Packed arrays of the target type are
+ * copied with a single `memcpy`.
+ *
+ * - Integer targets accept elements of every integer type whose value fits
+ * - `f32` / `f64` targets accept every numeric element, rounded to nearest
+ * - `bool` targets accept only boolean elements
+ *
+ * # Safety
+ * - `value` must be a valid GblnValue pointer
+ * - `out` must point to at least `n` writable elements (may be NULL if `n` is 0)
+ * - `n` must not exceed `gbln_array_len(value)`
+ *
+ * # Returns
+ * - `GBLN_OK` on success, with `n` elements written to `out`
+ * - `GBLN_ERROR_TYPE_MISMATCH` if value is not an array or an element has an
+ *   unsupported type; the contents of `out` are then unspecified
+ * - `GBLN_ERROR_INT_OUT_OF_RANGE` if an integer element does not fit the target
+ */
+enum GblnErrorCode gbln_array_copy_i8(const struct GblnValue *value,
+                                      int8_t *out,
+                                      uintptr_t n);
+
+/**
+ * Copy array elements as i16
+ *
+ * Same conversions and safety requirements as `gbln_array_copy_i8()`.
+ */
+enum GblnErrorCode gbln_array_copy_i16(const struct GblnValue *value,
+                                       int16_t *out,
+                                       uintptr_t n);
+
+/**
+ * Copy array elements as i32
+ *
+ * Same conversions and safety requirements as `gbln_array_copy_i8()`.
+ */
+enum GblnErrorCode gbln_array_copy_i32(const struct GblnValue *value,
+                                       int32_t *out,
+                                       uintptr_t n);
+
+/**
+ * Copy array elements as i64
+ *
+ * Same conversions and safety requirements as `gbln_array_copy_i8()`.
+ */
+enum GblnErrorCode gbln_array_copy_i64(const struct GblnValue *value,
+                                       int64_t *out,
+                                       uintptr_t n);
+
+/**
+ * Copy array elements as u8
+ *
+ * Same conversions and safety requirements as `gbln_array_copy_i8()`.
+ */
+enum GblnErrorCode gbln_array_copy_u8(const struct GblnValue *value,
+                                      uint8_t *out,
+                                      uintptr_t n);
+
+/**
+ * Copy array elements as u16
+ *
+ * Same conversions and safety requirements as `gbln_array_copy_i8()`.
+ */
+enum GblnErrorCode gbln_array_copy_u16(const struct GblnValue *value,
+                                       uint16_t *out,
+                                       uintptr_t n);
+
+/**
+ * Copy array elements as u32
+ *
+ * Same conversions and safety requirements as `gbln_array_copy_i8()`.
+ */
+enum GblnErrorCode gbln_array_copy_u32(const struct GblnValue *value,
+                                       uint32_t *out,
+                                       uintptr_t n);
+
+/**
+ * Copy array elements as u64
+ *
+ * Same conversions and safety requirements as `gbln_array_copy_i8()`.
+ */
+enum GblnErrorCode gbln_array_copy_u64(const struct GblnValue *value,
+                                       uint64_t *out,
+                                       uintptr_t n);
+
+/**
+ * Copy array elements as f32
+ *
+ * Same conversions and safety requirements as `gbln_array_copy_i8()`.
+ */
+enum GblnErrorCode gbln_array_copy_f32(const struct GblnValue *value,
+                                       float *out,
+                                       uintptr_t n);
+
+/**
+ * Copy array elements as f64
+ *
+ * Same conversions and safety requirements as `gbln_array_copy_i8()`.
+ */
+enum GblnErrorCode gbln_array_copy_f64(const struct GblnValue *value,
+                                       double *out,
+                                       uintptr_t n);
+
+/**
+ * Copy array elements as bool
+ *
+ * Same conversions and safety requirements as `gbln_array_copy_i8()`.
+ */
+enum GblnErrorCode gbln_array_copy_bool(const struct GblnValue *value,
+                                        bool *out,
+                                        uintptr_t n);
+
 /**
  * Get i8 value
  *
@@ -240,6 +1582,21 @@ double gbln_value_as_f64(const struct GblnValue *value, bool *ok);
  */
 char *gbln_value_as_string(const struct GblnValue *value, bool *ok);
 
+/**
+ * Get borrowed string value
+ *
+ * Returns a pointer to the UTF-8 bytes stored inside the value, without
+ * allocating or copying. The bytes are NOT null-terminated; use `out_len`.
+ *
+ * # Safety
+ * - `value` must be a valid GblnValue pointer
+ * - `out_len` must be a valid pointer to store the length in bytes
+ * - Returns NULL if value is not a string (empty strings return non-NULL with length 0)
+ * - Returned pointer is valid as long as the parent value is valid
+ * - Caller must NOT free the returned pointer
+ */
+const uint8_t *gbln_value_as_str_ref(const struct GblnValue *value, uintptr_t *out_len);
+
 /**
  * Get bool value
  */
@@ -406,6 +1763,28 @@ char **gbln_object_keys(const struct GblnValue *value, uintptr_t *out_count);
  */
 void gbln_keys_free(char **keys, uintptr_t count);
 
+/**
+ * Get object entry by index
+ *
+ * Returns the field at position `index` in document order, together with
+ * a borrowed view of its key. Iterating `0..gbln_object_len()` visits every
+ * field without copying keys or looking them up again.
+ *
+ * # Safety
+ * - `value` must be a valid GblnValue pointer
+ * - `out_key` must be a valid pointer to store the key bytes (UTF-8, NOT null-terminated)
+ * - `out_key_len` must be a valid pointer to store the key length in bytes
+ * - Returns NULL if value is not an object or index out of bounds
+ * - Returned value and key pointers are valid as long as the parent value is valid
+ * - For objects built by a parser or builder bound to a key table, the key
+ *   pointer is the interned copy and is the same for every equal key
+ * - Caller must NOT free the returned key pointer
+ */
+const struct GblnValue *gbln_object_entry_at(const struct GblnValue *value,
+                                             uintptr_t index,
+                                             const uint8_t **out_key,
+                                             uintptr_t *out_key_len);
+
 /**
  * Create i8 value
  */
@@ -459,9 +1838,12 @@ struct GblnValue *gbln_value_new_f64(double value);
 /**
  * Create string value
  *
+ * The string is validated as UTF-8 and its code points are counted in a
+ * single vectorised pass, the same one the parser uses for `sN` hints.
+ *
  * # Args
  * - value: null-terminated UTF-8 string
- * - max_len: maximum string length (for type hint)
+ * - max_len: maximum string length in Unicode code points (for type hint)
  *
  * # Returns
  * - GblnValue pointer on success
@@ -472,6 +1854,26 @@ struct GblnValue *gbln_value_new_f64(double value);
  */
 struct GblnValue *gbln_value_new_str(const char *value, uintptr_t max_len);
 
+/**
+ * Create string value from a length-delimited UTF-8 buffer
+ *
+ * Same as `gbln_value_new_str()`, but the input does not need to be
+ * null-terminated and is not scanned for its length.
+ *
+ * # Args
+ * - value: UTF-8 bytes
+ * - len: length of `value` in bytes
+ * - max_len: maximum string length in Unicode code points (for type hint)
+ *
+ * # Returns
+ * - GblnValue pointer on success
+ * - NULL if string exceeds max_len or invalid UTF-8
+ *
+ * # Safety
+ * - `value` must point to at least `len` readable bytes (may be NULL if `len` is 0)
+ */
+struct GblnValue *gbln_value_new_str_n(const uint8_t *value, uintptr_t len, uintptr_t max_len);
+
 /**
  * Create boolean value
  */
@@ -487,6 +1889,26 @@ struct GblnValue *gbln_value_new_null(void);
  */
 struct GblnValue *gbln_value_new_object(void);
 
+/**
+ * Create empty object with room for `capacity` fields
+ *
+ * Pre-sizes field storage and, above `GBLN_OBJECT_INDEX_THRESHOLD`, the
+ * hash index, so that building an object of known size never reallocates.
+ */
+struct GblnValue *gbln_value_new_object_with_capacity(uintptr_t capacity);
+
+/**
+ * Create empty object bound to a key intern table
+ *
+ * Keys passed to `gbln_object_insert()` on this object are interned in
+ * `table` rather than copied. Objects bound to the same table share key
+ * storage with each other and with documents from bound parsers.
+ *
+ * # Safety
+ * - `table` must be a valid GblnKeyTable pointer
+ */
+struct GblnValue *gbln_value_new_object_in(struct GblnKeyTable *table, uintptr_t capacity);
+
 /**
  * Insert field into object
  *
@@ -495,6 +1917,10 @@ struct GblnValue *gbln_value_new_object(void);
  * - `key` must be a valid null-terminated UTF-8 string
  * - `value` ownership is transferred to the object
  *
+ * Fields keep insertion order for serialisation. The duplicate-key check
+ * uses the object's hash index once it passes `GBLN_OBJECT_INDEX_THRESHOLD`
+ * fields, so inserting n fields costs O(n) overall rather than O(n²).
+ *
  * # Returns
  * - GBLN_OK on success
  * - GBLN_ERROR_DUPLICATE_KEY if key already exists
@@ -556,6 +1982,27 @@ enum GblnErrorCode gbln_write_io(const struct GblnValue *value,
                                  const char *path,
                                  const struct GblnConfig *config);
 
+/**
+ * Write GBLN value to I/O format file, reporting errors by out-struct
+ *
+ * Same as `gbln_write_io()`, but reports failure through `out_error`
+ * instead of the global last-error state.
+ *
+ * # Safety
+ * - `value` must be a valid GblnValue pointer
+ * - `path` must be a valid null-terminated UTF-8 string
+ * - `config` must be a valid GblnConfig pointer, or NULL for the I/O defaults
+ * - `out_error` must be a valid pointer, or NULL to discard error details
+ *
+ * # Returns
+ * - `GBLN_OK` on success
+ * - Error code on failure, with `out_error` filled
+ */
+enum GblnErrorCode gbln_write_io_err(const struct GblnValue *value,
+                                     const char *path,
+                                     const struct GblnConfig *config,
+                                     struct GblnErrorInfo *out_error);
+
 /**
  * Read GBLN file from I/O format
  *
@@ -584,4 +2031,65 @@ enum GblnErrorCode gbln_write_io(const struct GblnValue *value,
  */
 enum GblnErrorCode gbln_read_io(const char *path, struct GblnValue **out_value);
 
+/**
+ * Read GBLN file from I/O format, reporting errors by out-struct
+ *
+ * Same as `gbln_read_io()`, but reports failure through `out_error`
+ * instead of the global last-error state.
+ *
+ * # Safety
+ * - `path` must be a valid null-terminated UTF-8 string
+ * - `out_value` must be a valid pointer to store the result
+ * - Caller must free the returned value with `gbln_value_free()`
+ * - `out_error` must be a valid pointer, or NULL to discard error details
+ *
+ * # Returns
+ * - `GBLN_OK` on success, with `out_value` set to the parsed value
+ * - Error code on failure, with `out_error` filled
+ */
+enum GblnErrorCode gbln_read_io_err(const char *path,
+                                    struct GblnValue **out_value,
+                                    struct GblnErrorInfo *out_error);
+
+/**
+ * Read GBLN file from I/O format, parsing on multiple threads
+ *
+ * Same as `gbln_read_io()`, but the decompressed content is parsed with
+ * `gbln_parse_parallel()`.
+ *
+ * # Parameters
+ * - path: File path (null-terminated string)
+ * - nthreads: Maximum number of worker threads (0 = one per available core)
+ * - out_value: Pointer to store the parsed value
+ *
+ * # Safety
+ * - path must be a valid null-terminated UTF-8 string
+ * - out_value must be a valid pointer to store the result
+ * - Caller must free returned value with gbln_value_free()
+ */
+enum GblnErrorCode gbln_read_io_parallel(const char *path,
+                                         uintptr_t nthreads,
+                                         struct GblnValue **out_value);
+
+/**
+ * Read GBLN file from I/O format on multiple threads, reporting errors by out-struct
+ *
+ * Same as `gbln_read_io_parallel()`, but reports failure through `out_error`
+ * instead of the global last-error state.
+ *
+ * # Safety
+ * - `path` must be a valid null-terminated UTF-8 string
+ * - `out_value` must be a valid pointer to store the result
+ * - Caller must free the returned value with `gbln_value_free()`
+ * - `out_error` must be a valid pointer, or NULL to discard error details
+ *
+ * # Returns
+ * - `GBLN_OK` on success, with `out_value` set to the parsed value
+ * - Error code on failure, with `out_error` filled
+ */
+enum GblnErrorCode gbln_read_io_parallel_err(const char *path,
+                                             uintptr_t nthreads,
+                                             struct GblnValue **out_value,
+                                             struct GblnErrorInfo *out_error);
+
 #endif  /* GBLN_H */
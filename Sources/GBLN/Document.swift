@@ -0,0 +1,226 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+import CGBLN
+import Foundation
+
+/// On-demand GBLN document.
+///
+/// Opening a document only records a compact tape of the input's structure.
+/// Objects, arrays and scalars are decoded when a path first reaches them,
+/// so reading a handful of fields out of a large document costs far less
+/// than `parse(_:)`, which converts the whole tree.
+///
+/// Syntax errors are reported when the document is opened. Type-bound
+/// errors (integer range, string length) are reported only for values that
+/// are actually read.
+///
+/// # Examples
+///
+/// ```swift
+/// let doc = try GblnDocument(responseData)
+///
+/// let status = try doc.value(at: "response", "status") as? Int
+/// let userId = try doc.value(at: "response", "data", "user", "id") as? Int
+/// let firstTag = try doc.value(at: "tags", "0") as? String
+/// ```
+public final class GblnDocument {
+    private let docPtr: OpaquePointer
+    private let input: UnsafeMutableRawBufferPointer?
+
+    /// Open a raw UTF-8 byte buffer as a document.
+    ///
+    /// The bytes are copied once into storage owned by the document, which
+    /// the document's tape then points into.
+    ///
+    /// - Parameter buffer: UTF-8 encoded GBLN bytes
+    /// - Throws: `GblnError.parseFailure` if the input is not valid GBLN syntax
+    public convenience init(_ buffer: UnsafeRawBufferPointer) throws {
+        try self.init(ownedInput: FFI.copyInput(buffer))
+    }
+
+    /// Open UTF-8 encoded `Data` as a document.
+    ///
+    /// - Parameter data: UTF-8 encoded GBLN bytes
+    /// - Throws: `GblnError.parseFailure` if the input is not valid GBLN syntax
+    public convenience init(_ data: Data) throws {
+        try self.init(ownedInput: data.withUnsafeBytes(FFI.copyInput))
+    }
+
+    /// Open a GBLN string as a document.
+    ///
+    /// - Parameter gblnString: GBLN-formatted string
+    /// - Throws: `GblnError.parseFailure` if the input is not valid GBLN syntax
+    public convenience init(_ gblnString: String) throws {
+        var gblnString = gblnString
+
+        let input = gblnString.withUTF8 { utf8 in
+            FFI.copyInput(UnsafeRawBufferPointer(utf8))
+        }
+
+        try self.init(ownedInput: input)
+    }
+
+    /// Open an uncompressed GBLN file as a document.
+    ///
+    /// The file is memory-mapped rather than read, so only the pages that
+    /// the initial scan and later lookups touch are loaded. The file must
+    /// not be modified while the document is alive.
+    ///
+    /// - Parameter path: File path (absolute or relative)
+    /// - Throws: `GblnError.ioError` if the file cannot be mapped, or `GblnError.parseFailure` if invalid syntax
+    public init(contentsOfFile path: String) throws {
+        self.docPtr = try FFI.docOpen(path: path)
+        self.input = nil
+    }
+
+    /// Open a document over input storage owned by this instance.
+    ///
+    /// - Parameter input: Input bytes (ownership is taken, freed on error)
+    /// - Throws: `GblnError.parseFailure` if the input is not valid GBLN syntax
+    private init(ownedInput input: UnsafeMutableRawBufferPointer) throws {
+        do {
+            self.docPtr = try FFI.docOpen(bytes: UnsafeRawBufferPointer(input))
+        } catch {
+            input.deallocate()
+            throw error
+        }
+
+        self.input = input
+    }
+
+    /// Free the document and its copy or mapping of the input.
+    deinit {
+        FFI.docFree(docPtr)
+        input?.deallocate()
+    }
+
+    /// Read the value at a path of object keys and array indices.
+    ///
+    /// Only the values along the path and the addressed subtree are decoded.
+    /// Path elements applied to an object are keys; elements applied to an
+    /// array are parsed as decimal indices. `extract(_:from:)` resolves
+    /// paths the same way.
+    /// An empty path returns the whole document.
+    ///
+    /// - Parameter path: Object keys and array indices, outermost first
+    /// - Returns: Swift value, or `nil` if the path does not exist or addresses GBLN null
+    /// - Throws: `GblnError.parseFailure` if a value on the path fails validation
+    public func value(at path: String...) throws -> Any? {
+        return try value(at: path)
+    }
+
+    /// Read the value at a path of object keys and array indices.
+    ///
+    /// - Parameter path: Object keys and array indices, outermost first
+    /// - Returns: Swift value, or `nil` if the path does not exist or addresses GBLN null
+    /// - Throws: `GblnError.parseFailure` if a value on the path fails validation
+    public func value(at path: [String]) throws -> Any? {
+        guard let valuePtr = try resolve(path) else {
+            return nil
+        }
+
+        do {
+            return try gblnToSwift(valuePtr)
+        } catch {
+            // Prefer the document's deferred validation error over the accessor's
+            try checkError()
+            throw error
+        }
+    }
+
+    /// Read an integer array at a path as `[Int64]`.
+    ///
+    /// All elements are copied in one call, without creating a Swift value
+    /// per element. Elements of every integer type are accepted.
+    ///
+    /// - Parameter path: Object keys and array indices, outermost first
+    /// - Returns: Elements, or `nil` if the path does not exist
+    /// - Throws: `GblnError.parseError` if the value is not an array of integers that fit in `Int64`
+    public func int64Array(at path: String...) throws -> [Int64]? {
+        return try array(at: path, gbln_array_copy_i64)
+    }
+
+    /// Read a numeric array at a path as `[Double]`.
+    ///
+    /// All elements are copied in one call, without creating a Swift value
+    /// per element. Integer elements are converted to the nearest `Double`.
+    ///
+    /// - Parameter path: Object keys and array indices, outermost first
+    /// - Returns: Elements, or `nil` if the path does not exist
+    /// - Throws: `GblnError.parseError` if the value is not an array of numbers
+    public func doubleArray(at path: String...) throws -> [Double]? {
+        return try array(at: path, gbln_array_copy_f64)
+    }
+
+    /// Read a boolean array at a path as `[Bool]`.
+    ///
+    /// - Parameter path: Object keys and array indices, outermost first
+    /// - Returns: Elements, or `nil` if the path does not exist
+    /// - Throws: `GblnError.parseError` if the value is not an array of booleans
+    public func boolArray(at path: String...) throws -> [Bool]? {
+        return try array(at: path, gbln_array_copy_bool)
+    }
+
+    /// Copy the array at a path with one bulk copy call.
+    ///
+    /// - Parameters:
+    ///   - path: Object keys and array indices, outermost first
+    ///   - copier: Copy function for the element type
+    /// - Returns: Elements, or nil if the path does not exist
+    /// - Throws: `GblnError.parseError` if the array cannot be copied as `T`
+    private func array<T>(at path: [String], _ copier: FFI.ArrayCopier<T>) throws -> [T]? {
+        guard let valuePtr = try resolve(path) else {
+            return nil
+        }
+
+        do {
+            return try FFI.arrayCopy(valuePtr, copier)
+        } catch {
+            try checkError()
+            throw error
+        }
+    }
+
+    /// Throw the document's first deferred validation error, if any.
+    ///
+    /// - Throws: `GblnError.parseFailure` locating the invalid value in the input
+    private func checkError() throws {
+        try FFI.docCheckError(docPtr, input: input.map(UnsafeRawBufferPointer.init))
+    }
+
+    /// Walk a path from the root, decoding only the values on it.
+    ///
+    /// - Parameter path: Object keys and array indices, outermost first
+    /// - Returns: Pointer to the addressed value, or nil if not found
+    /// - Throws: `GblnError.parseFailure` if a value on the path fails validation
+    private func resolve(_ path: [String]) throws -> OpaquePointer? {
+        var current = try FFI.docRoot(docPtr)
+
+        for element in path {
+            let next: OpaquePointer?
+
+            switch FFI.valueType(current) {
+            case Object:
+                next = FFI.objectGet(current, key: element)
+            case Array:
+                guard let index = Int(element), index >= 0 else {
+                    return nil
+                }
+                next = FFI.arrayGet(current, index: index)
+            default:
+                return nil
+            }
+
+            try checkError()
+
+            guard let found = next else {
+                return nil
+            }
+
+            current = found
+        }
+
+        return current
+    }
+}
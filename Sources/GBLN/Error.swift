@@ -1,6 +1,7 @@
 // Copyright (c) 2025 Vivian Burkhard Voss
 // SPDX-License-Identifier: Apache-2.0
 
+import CGBLN
 import Foundation
 
 /// Errors that can occur during GBLN operations.
@@ -19,6 +20,21 @@ public enum GblnError: Error, LocalizedError {
     /// - String "VeryLongName" exceeds s8 limit (8 characters)
     case parseError(String)
 
+    /// Parsing failed at a known location in the input.
+    ///
+    /// Thrown by the functions that parse a caller-provided buffer. The
+    /// payload carries the error code and position as fields; its message
+    /// and suggestion text are only rendered when read.
+    ///
+    /// ```swift
+    /// do {
+    ///     try validate(payload)
+    /// } catch GblnError.parseFailure(let failure) {
+    ///     reject(payload, line: failure.line, column: failure.column)
+    /// }
+    /// ```
+    case parseFailure(GblnParseFailure)
+
     /// Validation failed with the given error message.
     ///
     /// This error occurs when a value violates GBLN's validation rules during
@@ -42,6 +58,8 @@ public enum GblnError: Error, LocalizedError {
         switch self {
         case .parseError(let msg):
             return "Parse error: \(msg)"
+        case .parseFailure(let failure):
+            return "Parse error: \(failure)"
         case .validationError(let msg):
             return "Validation error: \(msg)"
         case .ioError(let msg):
@@ -51,3 +69,125 @@ public enum GblnError: Error, LocalizedError {
         }
     }
 }
+
+/// Location and cause of a parse failure.
+///
+/// Reporting a failure copies the error fields and at most
+/// `tokenCapacity` bytes of the offending token; no text is built until
+/// `message`, `suggestion` or `description` is read.
+public struct GblnParseFailure: Error, CustomStringConvertible {
+    /// Cause of a parse failure.
+    public enum Reason: Equatable {
+        case unexpectedChar
+        case unterminatedString
+        case unexpectedToken
+        case unexpectedEof
+        case invalidSyntax
+        case intOutOfRange
+        case stringTooLong
+        case typeMismatch
+        case invalidTypeHint
+        case duplicateKey
+        case io
+        case missingField
+        /// Code not known to this version of the bindings.
+        case other(Int)
+    }
+
+    /// Maximum number of token bytes kept for rendering.
+    public static let tokenCapacity = 64
+
+    /// Cause of the failure.
+    public let reason: Reason
+
+    /// Byte offset of the offending token in the input.
+    public let offset: Int
+
+    /// Byte length of the offending token (0 at end of input).
+    public let length: Int
+
+    /// 1-based line of `offset`.
+    public let line: Int
+
+    /// 1-based column of `offset`, counted in code points.
+    public let column: Int
+
+    /// Error as reported by the C layer, with `offset` rebased onto `token`.
+    private let info: GblnErrorInfo
+
+    /// Copy of the offending token, empty if the input was not available.
+    private let token: [UInt8]
+
+    /// Create a failure from a structured C error.
+    ///
+    /// - Parameters:
+    ///   - error: Structured error filled by a `*_err` function
+    ///   - input: Input the error was reported for, or `nil`
+    init(_ error: GblnErrorInfo, input: UnsafeRawBufferPointer?) {
+        reason = Reason(error.code)
+        offset = Int(error.offset)
+        length = Int(error.len)
+        line = Int(error.line)
+        column = Int(error.column)
+
+        var info = error
+        if let input = input, Int(error.offset) < input.count {
+            let start = Int(error.offset)
+            let end = min(start + min(Int(error.len), Self.tokenCapacity), input.count)
+            token = Array(input[start..<end])
+            info.offset = 0
+            info.len = UInt(token.count)
+        } else {
+            token = []
+        }
+        self.info = info
+    }
+
+    /// Error message, including line and column.
+    public var message: String {
+        return render(gbln_error_message)
+    }
+
+    /// Suggested fix, or `nil` if none is available.
+    public var suggestion: String? {
+        let text = render(gbln_error_suggestion)
+        return text.isEmpty ? nil : text
+    }
+
+    /// Error message, with suggestion appended if available.
+    public var description: String {
+        guard let suggestion = suggestion else {
+            return message
+        }
+        return "\(message)\nSuggestion: \(suggestion)"
+    }
+
+    private func render(_ renderer: FFI.ErrorRenderer) -> String {
+        guard !token.isEmpty else {
+            return FFI.renderError(renderer, info, input: nil)
+        }
+        return token.withUnsafeBytes { buffer in
+            FFI.renderError(renderer, info, input: buffer)
+        }
+    }
+}
+
+extension GblnParseFailure.Reason {
+    init(_ code: GblnErrorCode) {
+        switch code {
+        case ErrorUnexpectedChar: self = .unexpectedChar
+        case ErrorUnterminatedString: self = .unterminatedString
+        case ErrorUnexpectedToken: self = .unexpectedToken
+        case ErrorUnexpectedEof: self = .unexpectedEof
+        case ErrorInvalidSyntax: self = .invalidSyntax
+        case ErrorIntOutOfRange: self = .intOutOfRange
+        case ErrorStringTooLong: self = .stringTooLong
+        case ErrorTypeMismatch: self = .typeMismatch
+        case ErrorInvalidTypeHint: self = .invalidTypeHint
+        case ErrorDuplicateKey: self = .duplicateKey
+        case ErrorIo: self = .io
+        case ErrorMissingField: self = .missingField
+        default: self = .other(Int(code.rawValue))
+        }
+    }
+}
@@ -0,0 +1,125 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+import CGBLN
+import Foundation
+
+/// GBLN value type.
+///
+/// Mirrors the type hints of the GBLN type system, plus the two
+/// container types.
+public enum GblnType: String {
+    case i8, i16, i32, i64
+    case u8, u16, u32, u64
+    case f32, f64
+    case string
+    case bool
+    case null
+    case object
+    case array
+}
+
+/// Event reported by the streaming parsers.
+///
+/// A keyed value is reported as `.key` followed by the value itself
+/// (`.scalar`, `.beginObject` or `.beginArray`). Array elements and
+/// top-level values have no preceding `.key`.
+///
+/// # Examples
+///
+/// `user{id<u32>(123)tags<s16>[a b]}` produces:
+///
+/// ```
+/// .key("user"), .beginObject,
+///     .key("id"), .scalar(value: 123, type: .u32),
+///     .key("tags"), .beginArray,
+///         .scalar(value: "a", type: .string), .scalar(value: "b", type: .string),
+///     .endArray,
+/// .endObject
+/// ```
+public enum GblnStreamEvent {
+    /// Start of an object.
+    case beginObject
+
+    /// End of the innermost open object.
+    case endObject
+
+    /// Start of an array.
+    case beginArray
+
+    /// End of the innermost open array.
+    case endArray
+
+    /// Key of the value that follows.
+    case key(String)
+
+    /// Scalar value with its declared type; `nil` for GBLN null.
+    case scalar(value: Any?, type: GblnType)
+}
+
+// MARK: - Internal C FFI Conversion
+
+internal extension GblnType {
+    /// Create from C value type.
+    ///
+    /// - Parameter valueType: C value type enum
+    init(_ valueType: GblnValueType) {
+        switch valueType {
+        case I8: self = .i8
+        case I16: self = .i16
+        case I32: self = .i32
+        case I64: self = .i64
+        case U8: self = .u8
+        case U16: self = .u16
+        case U32: self = .u32
+        case U64: self = .u64
+        case F32: self = .f32
+        case F64: self = .f64
+        case Str: self = .string
+        case Bool: self = .bool
+        case Object: self = .object
+        case Array: self = .array
+        default: self = .null
+        }
+    }
+}
+
+internal extension GblnStreamEvent {
+    /// Create from C streaming event.
+    ///
+    /// Borrowed key bytes and scalar values are copied into Swift values,
+    /// so the result outlives the C event.
+    ///
+    /// - Parameter event: C event (valid only for the duration of this call)
+    /// - Throws: `GblnError.parseError` if the event is malformed
+    init(_ event: CGBLN.GblnEvent) throws {
+        switch event.kind {
+        case EventBeginObject:
+            self = .beginObject
+
+        case EventEndObject:
+            self = .endObject
+
+        case EventBeginArray:
+            self = .beginArray
+
+        case EventEndArray:
+            self = .endArray
+
+        case EventKey:
+            guard let text = event.text else {
+                throw GblnError.parseError("Key event without key")
+            }
+            self = .key(String(decoding: UnsafeBufferPointer(start: text, count: Int(event.text_len)), as: UTF8.self))
+
+        case EventScalar:
+            guard let valuePtr = event.value else {
+                throw GblnError.parseError("Scalar event without value")
+            }
+            self = .scalar(value: try gblnToSwift(valuePtr), type: GblnType(event.value_type))
+
+        default:
+            throw GblnError.parseError("Unknown GBLN event type: \(event.kind.rawValue)")
+        }
+    }
+}
@@ -10,6 +10,12 @@ import Foundation
 /// handling pointer conversions, error checking, and memory management.
 ///
 /// All functions throw `GblnError` on failure instead of returning error codes.
+///
+/// Values returned by the parse functions are arena-backed and read-only:
+/// the only thing callers do with them is convert them to Swift and free
+/// the root. `gbln_object_insert()` and `gbln_array_push()` are only ever
+/// called on values created by the builder in `swiftToGbln`, and never
+/// receive a parsed value as their argument either.
 internal enum FFI {
 
     // MARK: - Error Handling
@@ -40,27 +46,341 @@ internal enum FFI {
         return String(cString: suggPtr)
     }
 
+    /// Signature shared by `gbln_error_message` and `gbln_error_suggestion`.
+    typealias ErrorRenderer = (
+        UnsafePointer<GblnErrorInfo>?, UnsafePointer<UInt8>?, UInt, UnsafeMutablePointer<CChar>?, UInt
+    ) -> UInt
+
+    /// Render structured error text.
+    ///
+    /// Renders into a stack buffer first and only allocates if the text
+    /// does not fit.
+    ///
+    /// - Parameters:
+    ///   - render: C rendering function
+    ///   - error: Structured error
+    ///   - input: Input the error was reported for, or `nil`
+    /// - Returns: Rendered text (empty if none)
+    static func renderError(
+        _ render: ErrorRenderer,
+        _ error: GblnErrorInfo,
+        input: UnsafeRawBufferPointer?
+    ) -> String {
+        var error = error
+        let bytes = input?.baseAddress?.assumingMemoryBound(to: UInt8.self)
+        let count = UInt(input?.count ?? 0)
+
+        return withUnsafeTemporaryAllocation(of: UInt8.self, capacity: 256) { buf in
+            let needed = Int(buf.withMemoryRebound(to: CChar.self) { chars in
+                render(&error, bytes, count, chars.baseAddress, UInt(chars.count))
+            })
+
+            if needed < buf.count {
+                return String(decoding: buf[..<needed], as: UTF8.self)
+            }
+
+            return String(unsafeUninitializedCapacity: needed + 1) { large in
+                _ = large.withMemoryRebound(to: CChar.self) { chars in
+                    render(&error, bytes, count, chars.baseAddress, UInt(chars.count))
+                }
+                return needed
+            }
+        }
+    }
+
+    /// Build a parse failure from a structured error.
+    ///
+    /// Copies the error fields and the offending token only; message and
+    /// suggestion are rendered when the failure is displayed.
+    ///
+    /// - Parameters:
+    ///   - error: Structured error filled by a `*_err` function
+    ///   - input: Input the error was reported for, or `nil`
+    /// - Returns: Error to throw
+    static func parseFailure(_ error: GblnErrorInfo, input: UnsafeRawBufferPointer?) -> GblnError {
+        return GblnError.parseFailure(GblnParseFailure(error, input: input))
+    }
+
+    /// Build I/O error message from a structured error.
+    ///
+    /// - Parameters:
+    ///   - error: Structured error filled by a `*_err` function
+    ///   - path: File the error was reported for
+    /// - Returns: Error message naming the file
+    static func ioErrorMessage(_ error: GblnErrorInfo, path: String) -> String {
+        return "\(path): \(renderError(gbln_error_message, error, input: nil))"
+    }
+
     // MARK: - Parse
 
     /// Parse GBLN string to value.
     ///
-    /// Calls C function: `gbln_parse(const char* input, GblnValue** out_value)`
+    /// Passes the string's contiguous UTF-8 storage to `parse(bytes:)`, so
+    /// native Swift strings are parsed without a C string copy.
     ///
     /// - Parameter input: GBLN-formatted string
-    /// - Returns: Opaque pointer to GblnValue (caller owns, must free)
-    /// - Throws: `GblnError.parseError` if parsing fails
+    /// - Returns: Opaque pointer to read-only, arena-backed GblnValue (caller owns, must free)
+    /// - Throws: `GblnError.parseFailure` if parsing fails
     static func parse(_ input: String) throws -> OpaquePointer {
+        var input = input
+
+        return try input.withUTF8 { utf8 in
+            try parse(bytes: UnsafeRawBufferPointer(utf8))
+        }
+    }
+
+    /// Parse GBLN from a length-delimited UTF-8 byte buffer.
+    ///
+    /// Calls C function: `gbln_parse_arena_err(const uint8_t* input, size_t len, GblnValue** out_value, GblnErrorInfo* out_error)`
+    ///
+    /// The buffer is passed to the C side as-is, without copying it into a
+    /// null-terminated C string first. The whole tree lives in one arena,
+    /// so freeing the root is a single deallocation.
+    ///
+    /// The tree is read-only: neither the root nor any child may be mutated
+    /// or inserted into another value, and children must not be freed.
+    ///
+    /// - Parameter buffer: UTF-8 encoded GBLN bytes
+    /// - Returns: Opaque pointer to read-only, arena-backed GblnValue (caller owns, must free)
+    /// - Throws: `GblnError.parseFailure` if parsing fails
+    static func parse(bytes buffer: UnsafeRawBufferPointer) throws -> OpaquePointer {
+        var outValue: OpaquePointer?
+        var error = GblnErrorInfo()
+
+        let bytes = buffer.baseAddress?.assumingMemoryBound(to: UInt8.self)
+        let result = gbln_parse_arena_err(bytes, UInt(buffer.count), &outValue, &error)
+
+        guard result == Ok else {
+            throw parseFailure(error, input: buffer)
+        }
+
+        guard let valuePtr = outValue else {
+            throw GblnError.parseError("Parse returned null pointer")
+        }
+
+        return valuePtr
+    }
+
+    /// Parse MINI GBLN from a length-delimited UTF-8 byte buffer.
+    ///
+    /// Calls C function: `gbln_parse_mini_err(const uint8_t* input, size_t len, GblnValue** out_value, GblnErrorInfo* out_error)`
+    ///
+    /// - Parameter buffer: UTF-8 encoded MINI GBLN bytes
+    /// - Returns: Opaque pointer to read-only, arena-backed GblnValue (caller owns, must free)
+    /// - Throws: `GblnError.parseFailure` if parsing fails or the input is not MINI GBLN
+    static func parseMini(bytes buffer: UnsafeRawBufferPointer) throws -> OpaquePointer {
+        var outValue: OpaquePointer?
+        var error = GblnErrorInfo()
+
+        let bytes = buffer.baseAddress?.assumingMemoryBound(to: UInt8.self)
+        let result = gbln_parse_mini_err(bytes, UInt(buffer.count), &outValue, &error)
+
+        guard result == Ok else {
+            throw parseFailure(error, input: buffer)
+        }
+
+        guard let valuePtr = outValue else {
+            throw GblnError.parseError("Parse returned null pointer")
+        }
+
+        return valuePtr
+    }
+
+    /// Parse GBLN file through a memory mapping.
+    ///
+    /// Calls C function: `gbln_parse_file_err(const char* path, GblnValue** out_value, GblnErrorInfo* out_error)`
+    ///
+    /// - Parameter path: Input file path
+    /// - Returns: Opaque pointer to read-only, arena-backed GblnValue (caller owns, must free)
+    /// - Throws: `GblnError.ioError` if the file cannot be read, `GblnError.parseFailure` if invalid GBLN
+    static func parseFile(path: String) throws -> OpaquePointer {
+        var outValue: OpaquePointer?
+        var error = GblnErrorInfo()
+
+        let result = path.withCString { pathCStr in
+            gbln_parse_file_err(pathCStr, &outValue, &error)
+        }
+
+        guard result == Ok else {
+            if result == ErrorIo {
+                throw GblnError.ioError(ioErrorMessage(error, path: path))
+            }
+            throw parseFailure(error, input: nil)
+        }
+
+        guard let valuePtr = outValue else {
+            throw GblnError.parseError("Parse returned null pointer")
+        }
+
+        return valuePtr
+    }
+
+    /// Extract a single value from GBLN bytes by path.
+    ///
+    /// Calls C function: `gbln_extract_err(const uint8_t* input, size_t len, const char* path, GblnValue** out_value, GblnErrorInfo* out_error)`
+    ///
+    /// - Parameters:
+    ///   - buffer: UTF-8 encoded GBLN bytes
+    ///   - path: Dot-separated path, e.g. `response.data.user.id`
+    /// - Returns: Opaque pointer to GblnValue (caller owns, must free), or nil if the path does not exist
+    /// - Throws: `GblnError.parseFailure` if the input is invalid
+    static func extract(bytes buffer: UnsafeRawBufferPointer, path: String) throws -> OpaquePointer? {
+        var outValue: OpaquePointer?
+        var error = GblnErrorInfo()
+
+        let bytes = buffer.baseAddress?.assumingMemoryBound(to: UInt8.self)
+        let result = path.withCString { pathCStr in
+            gbln_extract_err(bytes, UInt(buffer.count), pathCStr, &outValue, &error)
+        }
+
+        guard result == Ok else {
+            throw parseFailure(error, input: buffer)
+        }
+
+        return outValue
+    }
+
+    /// Validate GBLN bytes without building a value.
+    ///
+    /// Calls C function: `gbln_validate_err(const uint8_t* input, size_t len, GblnErrorInfo* out_error)`
+    ///
+    /// - Parameter buffer: UTF-8 encoded GBLN bytes
+    /// - Throws: `GblnError.parseFailure` if the input is not valid GBLN
+    static func validate(bytes buffer: UnsafeRawBufferPointer) throws {
+        var error = GblnErrorInfo()
+
+        let bytes = buffer.baseAddress?.assumingMemoryBound(to: UInt8.self)
+        let result = gbln_validate_err(bytes, UInt(buffer.count), &error)
+
+        guard result == Ok else {
+            throw parseFailure(error, input: buffer)
+        }
+    }
+
+    /// Check GBLN bytes without building a value or any error text.
+    ///
+    /// Calls C function: `gbln_validate_err(const uint8_t* input, size_t len, NULL)`
+    ///
+    /// - Parameter buffer: UTF-8 encoded GBLN bytes
+    /// - Returns: `true` if the input is valid GBLN
+    static func isValid(bytes buffer: UnsafeRawBufferPointer) -> Bool {
+        let bytes = buffer.baseAddress?.assumingMemoryBound(to: UInt8.self)
+        return gbln_validate_err(bytes, UInt(buffer.count), nil) == Ok
+    }
+
+    /// Parse GBLN bytes on multiple threads.
+    ///
+    /// Calls C function: `gbln_parse_parallel_err(const uint8_t* input, size_t len, size_t nthreads, GblnValue** out_value, GblnErrorInfo* out_error)`
+    ///
+    /// - Parameters:
+    ///   - buffer: UTF-8 encoded GBLN bytes
+    ///   - threads: Maximum number of worker threads (0 = one per core)
+    /// - Returns: Opaque pointer to GblnValue (caller owns, must free)
+    /// - Throws: `GblnError.parseFailure` if parsing fails
+    static func parseParallel(bytes buffer: UnsafeRawBufferPointer, threads: Int) throws -> OpaquePointer {
         var outValue: OpaquePointer?
+        var error = GblnErrorInfo()
+
+        let bytes = buffer.baseAddress?.assumingMemoryBound(to: UInt8.self)
+        let result = gbln_parse_parallel_err(bytes, UInt(buffer.count), UInt(threads), &outValue, &error)
+
+        guard result == Ok else {
+            throw parseFailure(error, input: buffer)
+        }
+
+        guard let valuePtr = outValue else {
+            throw GblnError.parseError("Parse returned null pointer")
+        }
 
-        let result = input.withCString { cString in
-            gbln_parse(cString, &outValue)
+        return valuePtr
+    }
+
+    /// Parse a newline-delimited GBLN record stream on multiple threads.
+    ///
+    /// Calls C function: `gbln_parse_stream_batch_err(const uint8_t* input, size_t len, size_t nthreads, GblnValue*** out_values, size_t* out_count, GblnErrorInfo* out_error)`
+    ///
+    /// - Parameters:
+    ///   - buffer: UTF-8 encoded record stream
+    ///   - threads: Maximum number of worker threads (0 = one per core)
+    /// - Returns: Array of value pointers and its count (caller owns, must free with `freeValues`)
+    /// - Throws: `GblnError.parseFailure` if any record fails to parse
+    static func parseStreamBatch(
+        bytes buffer: UnsafeRawBufferPointer,
+        threads: Int
+    ) throws -> (values: UnsafeMutablePointer<OpaquePointer?>?, count: Int) {
+        var outValues: UnsafeMutablePointer<OpaquePointer?>?
+        var count: UInt = 0
+        var error = GblnErrorInfo()
+
+        let bytes = buffer.baseAddress?.assumingMemoryBound(to: UInt8.self)
+        let result = gbln_parse_stream_batch_err(bytes, UInt(buffer.count), UInt(threads), &outValues, &count, &error)
+
+        guard result == Ok else {
+            throw parseFailure(error, input: buffer)
+        }
+
+        return (outValues, Int(count))
+    }
+
+    /// Get structural scanner backend selected by libgbln.
+    ///
+    /// Calls C function: `gbln_scanner_backend()`
+    ///
+    /// - Returns: Backend name (`scalar`, `sse42`, `avx2` or `neon`)
+    static func scannerBackend() -> String {
+        switch gbln_scanner_backend() {
+        case Sse42:
+            return "sse42"
+        case Avx2:
+            return "avx2"
+        case Neon:
+            return "neon"
+        default:
+            return "scalar"
+        }
+    }
+
+    // MARK: - Parser Context
+
+    /// Create reusable parser context.
+    ///
+    /// Calls C function: `gbln_parser_new()`
+    ///
+    /// - Returns: Opaque pointer to GblnParser (caller owns, must free with `parserFree`)
+    /// - Throws: `GblnError.parseError` if the context cannot be created
+    static func parserNew() throws -> OpaquePointer {
+        guard let parserPtr = gbln_parser_new() else {
+            throw GblnError.parseError("Failed to create parser context")
         }
 
+        return parserPtr
+    }
+
+    /// Free parser context.
+    ///
+    /// - Parameter parserPtr: Pointer to GblnParser to free
+    static func parserFree(_ parserPtr: OpaquePointer) {
+        gbln_parser_free(parserPtr)
+    }
+
+    /// Parse GBLN bytes with a reusable parser context.
+    ///
+    /// Calls C function: `gbln_parser_parse_err(GblnParser* parser, const uint8_t* input, size_t len, GblnValue** out_value, GblnErrorInfo* out_error)`
+    ///
+    /// - Parameters:
+    ///   - parserPtr: Pointer to GblnParser
+    ///   - buffer: UTF-8 encoded GBLN bytes
+    /// - Returns: Opaque pointer to GblnValue owned by the parser (must NOT be freed)
+    /// - Throws: `GblnError.parseFailure` if parsing fails
+    static func parserParse(_ parserPtr: OpaquePointer, bytes buffer: UnsafeRawBufferPointer) throws -> OpaquePointer {
+        var outValue: OpaquePointer?
+        var error = GblnErrorInfo()
+
+        let bytes = buffer.baseAddress?.assumingMemoryBound(to: UInt8.self)
+        let result = gbln_parser_parse_err(parserPtr, bytes, UInt(buffer.count), &outValue, &error)
+
         guard result == Ok else {
-            let errorMsg = getErrorMessage()
-            let suggestion = getErrorSuggestion()
-            let fullMsg = suggestion.isEmpty ? errorMsg : "\(errorMsg)\nSuggestion: \(suggestion)"
-            throw GblnError.parseError(fullMsg)
+            throw parseFailure(error, input: buffer)
         }
 
         guard let valuePtr = outValue else {
@@ -70,6 +390,359 @@ internal enum FFI {
         return valuePtr
     }
 
+    /// Reset parser context, keeping its buffers.
+    ///
+    /// - Parameter parserPtr: Pointer to GblnParser
+    static func parserReset(_ parserPtr: OpaquePointer) {
+        gbln_parser_reset(parserPtr)
+    }
+
+    // MARK: - Key Table
+
+    /// Create shared key intern table.
+    ///
+    /// Calls C function: `gbln_key_table_new()`
+    ///
+    /// - Returns: Opaque pointer to GblnKeyTable (caller owns, must free with `keyTableFree`)
+    /// - Throws: `GblnError.parseError` if the table cannot be created
+    static func keyTableNew() throws -> OpaquePointer {
+        guard let tablePtr = gbln_key_table_new() else {
+            throw GblnError.parseError("Failed to create key table")
+        }
+
+        return tablePtr
+    }
+
+    /// Release key intern table.
+    ///
+    /// - Parameter tablePtr: Pointer to GblnKeyTable to release
+    static func keyTableFree(_ tablePtr: OpaquePointer) {
+        gbln_key_table_free(tablePtr)
+    }
+
+    /// Get number of distinct keys in a key intern table.
+    ///
+    /// - Parameter tablePtr: Pointer to GblnKeyTable
+    /// - Returns: Number of interned keys
+    static func keyTableCount(_ tablePtr: OpaquePointer) -> Int {
+        return Int(gbln_key_table_len(tablePtr))
+    }
+
+    /// Bind parser context to a key intern table.
+    ///
+    /// Calls C function: `gbln_parser_set_key_table(GblnParser* parser, GblnKeyTable* table)`
+    ///
+    /// - Parameters:
+    ///   - parserPtr: Pointer to GblnParser
+    ///   - tablePtr: Pointer to GblnKeyTable, or nil to unbind
+    /// - Throws: `GblnError.parseError` if the table cannot be bound
+    static func parserSetKeyTable(_ parserPtr: OpaquePointer, _ tablePtr: OpaquePointer?) throws {
+        guard gbln_parser_set_key_table(parserPtr, tablePtr) == Ok else {
+            throw GblnError.parseError("Failed to bind key table to parser")
+        }
+    }
+
+    // MARK: - Push Parser
+
+    /// Create incremental push parser.
+    ///
+    /// Calls C function: `gbln_push_new(GblnEventCallback callback, void* user_data)`
+    ///
+    /// - Parameters:
+    ///   - callback: C event callback
+    ///   - userData: Context pointer passed to every callback invocation
+    /// - Returns: Opaque pointer to GblnPushParser (caller owns, must free with `pushFree`)
+    /// - Throws: `GblnError.parseError` if the parser cannot be created
+    static func pushNew(callback: GblnEventCallback, userData: UnsafeMutableRawPointer) throws -> OpaquePointer {
+        guard let pushPtr = gbln_push_new(callback, userData) else {
+            throw GblnError.parseError("Failed to create push parser")
+        }
+
+        return pushPtr
+    }
+
+    /// Feed a chunk of input to a push parser.
+    ///
+    /// Calls C function: `gbln_push_feed_err(GblnPushParser* ctx, const uint8_t* buf, size_t len, GblnErrorInfo* out_error)`
+    ///
+    /// The reported location counts from the first byte fed, so the
+    /// failure carries no token text.
+    ///
+    /// - Parameters:
+    ///   - pushPtr: Pointer to GblnPushParser
+    ///   - buffer: Next chunk of UTF-8 encoded GBLN bytes
+    /// - Returns: `Ok`, or `ErrorCallbackAborted` if the callback stopped parsing
+    /// - Throws: `GblnError.parseFailure` if the input is invalid
+    static func pushFeed(_ pushPtr: OpaquePointer, bytes buffer: UnsafeRawBufferPointer) throws -> GblnErrorCode {
+        var error = GblnErrorInfo()
+
+        let bytes = buffer.baseAddress?.assumingMemoryBound(to: UInt8.self)
+        let result = gbln_push_feed_err(pushPtr, bytes, UInt(buffer.count), &error)
+
+        guard result == Ok || result == ErrorCallbackAborted else {
+            throw parseFailure(error, input: nil)
+        }
+
+        return result
+    }
+
+    /// Signal end of input to a push parser.
+    ///
+    /// Calls C function: `gbln_push_finish_err(GblnPushParser* ctx, GblnErrorInfo* out_error)`
+    ///
+    /// - Parameter pushPtr: Pointer to GblnPushParser
+    /// - Returns: `Ok`, or `ErrorCallbackAborted` if the callback stopped parsing
+    /// - Throws: `GblnError.parseFailure` if the input ended mid-document
+    static func pushFinish(_ pushPtr: OpaquePointer) throws -> GblnErrorCode {
+        var error = GblnErrorInfo()
+
+        let result = gbln_push_finish_err(pushPtr, &error)
+
+        guard result == Ok || result == ErrorCallbackAborted else {
+            throw parseFailure(error, input: nil)
+        }
+
+        return result
+    }
+
+    /// Free push parser.
+    ///
+    /// - Parameter pushPtr: Pointer to GblnPushParser to free
+    static func pushFree(_ pushPtr: OpaquePointer) {
+        gbln_push_free(pushPtr)
+    }
+
+    // MARK: - Event Reader
+
+    /// Create event reader over a byte buffer.
+    ///
+    /// Calls C function: `gbln_reader_new_buffer(const uint8_t* input, size_t len)`
+    ///
+    /// - Parameter buffer: UTF-8 encoded GBLN bytes (must outlive the reader)
+    /// - Returns: Opaque pointer to GblnReader (caller owns, must free with `readerFree`)
+    /// - Throws: `GblnError.parseError` if the reader cannot be created
+    static func readerNew(bytes buffer: UnsafeRawBufferPointer) throws -> OpaquePointer {
+        let bytes = buffer.baseAddress?.assumingMemoryBound(to: UInt8.self)
+
+        guard let readerPtr = gbln_reader_new_buffer(bytes, UInt(buffer.count)) else {
+            throw GblnError.parseError("Failed to create reader")
+        }
+
+        return readerPtr
+    }
+
+    /// Create event reader over a file descriptor.
+    ///
+    /// Calls C function: `gbln_reader_new_fd(int fd)`
+    ///
+    /// - Parameter fd: Readable file descriptor (must stay open while the reader lives)
+    /// - Returns: Opaque pointer to GblnReader (caller owns, must free with `readerFree`)
+    /// - Throws: `GblnError.ioError` if the reader cannot be created
+    static func readerNew(fileDescriptor fd: Int32) throws -> OpaquePointer {
+        guard let readerPtr = gbln_reader_new_fd(fd) else {
+            throw GblnError.ioError("Failed to create reader for file descriptor \(fd)")
+        }
+
+        return readerPtr
+    }
+
+    /// Read next event.
+    ///
+    /// Calls C function: `gbln_reader_next_err(GblnReader* reader, GblnEvent* out_event, bool* out_has_event, GblnErrorInfo* out_error)`
+    ///
+    /// - Parameters:
+    ///   - readerPtr: Pointer to GblnReader
+    ///   - input: Buffer the reader was created over, or `nil` for a file descriptor reader
+    /// - Returns: C event (valid until the next call), or nil at end of input
+    /// - Throws: `GblnError.ioError` if reading fails, `GblnError.parseFailure` if the input is invalid
+    static func readerNext(_ readerPtr: OpaquePointer, input: UnsafeRawBufferPointer?) throws -> CGBLN.GblnEvent? {
+        var event = CGBLN.GblnEvent()
+        var hasEvent = false
+        var error = GblnErrorInfo()
+
+        let result = gbln_reader_next_err(readerPtr, &event, &hasEvent, &error)
+
+        guard result == Ok else {
+            if result == ErrorIo {
+                // No OS error means the stream was rejected as XZ-compressed
+                if error.os_error == 0 {
+                    throw GblnError.ioError("Input is XZ-compressed; use readIo(from:) to read it")
+                }
+                throw GblnError.ioError(renderError(gbln_error_message, error, input: nil))
+            }
+            throw parseFailure(error, input: input)
+        }
+
+        return hasEvent ? event : nil
+    }
+
+    /// Free event reader.
+    ///
+    /// - Parameter readerPtr: Pointer to GblnReader to free
+    static func readerFree(_ readerPtr: OpaquePointer) {
+        gbln_reader_free(readerPtr)
+    }
+
+    // MARK: - Input Buffers
+
+    /// Copy input bytes into storage that outlives the caller's buffer.
+    ///
+    /// Used for C objects that borrow their input for their whole lifetime.
+    ///
+    /// - Parameter buffer: Bytes to copy
+    /// - Returns: Owned buffer (caller must `deallocate()`)
+    static func copyInput(_ buffer: UnsafeRawBufferPointer) -> UnsafeMutableRawBufferPointer {
+        let input = UnsafeMutableRawBufferPointer.allocate(byteCount: buffer.count, alignment: 1)
+        input.copyMemory(from: buffer)
+        return input
+    }
+
+    // MARK: - On-Demand Document
+
+    /// Open GBLN bytes as an on-demand document.
+    ///
+    /// Calls C function: `gbln_doc_open_err(const uint8_t* input, size_t len, GblnDoc** out_doc, GblnErrorInfo* out_error)`
+    ///
+    /// - Parameter buffer: UTF-8 encoded GBLN bytes (must outlive the document)
+    /// - Returns: Opaque pointer to GblnDoc (caller owns, must free with `docFree`)
+    /// - Throws: `GblnError.parseFailure` if the input is not valid GBLN syntax
+    static func docOpen(bytes buffer: UnsafeRawBufferPointer) throws -> OpaquePointer {
+        var outDoc: OpaquePointer?
+        var error = GblnErrorInfo()
+
+        let bytes = buffer.baseAddress?.assumingMemoryBound(to: UInt8.self)
+        let result = gbln_doc_open_err(bytes, UInt(buffer.count), &outDoc, &error)
+
+        guard result == Ok else {
+            throw parseFailure(error, input: buffer)
+        }
+
+        guard let docPtr = outDoc else {
+            throw GblnError.parseError("Document open returned null pointer")
+        }
+
+        return docPtr
+    }
+
+    /// Open GBLN file as an on-demand document through a memory mapping.
+    ///
+    /// Calls C function: `gbln_doc_open_file_err(const char* path, GblnDoc** out_doc, GblnErrorInfo* out_error)`
+    ///
+    /// - Parameter path: Input file path
+    /// - Returns: Opaque pointer to GblnDoc (caller owns, must free with `docFree`)
+    /// - Throws: `GblnError.ioError` if the file cannot be mapped, `GblnError.parseFailure` if invalid syntax
+    static func docOpen(path: String) throws -> OpaquePointer {
+        var outDoc: OpaquePointer?
+        var error = GblnErrorInfo()
+
+        let result = path.withCString { pathCStr in
+            gbln_doc_open_file_err(pathCStr, &outDoc, &error)
+        }
+
+        guard result == Ok else {
+            if result == ErrorIo {
+                throw GblnError.ioError(ioErrorMessage(error, path: path))
+            }
+            throw parseFailure(error, input: nil)
+        }
+
+        guard let docPtr = outDoc else {
+            throw GblnError.parseError("Document open returned null pointer")
+        }
+
+        return docPtr
+    }
+
+    /// Get root value of an on-demand document.
+    ///
+    /// - Parameter docPtr: Pointer to GblnDoc
+    /// - Returns: Pointer to root value owned by the document (must NOT be freed)
+    /// - Throws: `GblnError.parseError` if the document has no root value
+    static func docRoot(_ docPtr: OpaquePointer) throws -> OpaquePointer {
+        guard let rootPtr = gbln_doc_root(docPtr) else {
+            throw GblnError.parseError("Document has no root value")
+        }
+
+        return rootPtr
+    }
+
+    /// Check for deferred decoding errors of an on-demand document.
+    ///
+    /// Calls C function: `gbln_doc_error_err(const GblnDoc* doc, GblnErrorInfo* out_error)`
+    ///
+    /// - Parameters:
+    ///   - docPtr: Pointer to GblnDoc
+    ///   - input: Buffer the document was opened over, or `nil` for a mapped file
+    /// - Throws: `GblnError.parseFailure` if a decoded value failed validation
+    static func docCheckError(_ docPtr: OpaquePointer, input: UnsafeRawBufferPointer?) throws {
+        var error = GblnErrorInfo()
+
+        guard gbln_doc_error_err(docPtr, &error) == Ok else {
+            throw parseFailure(error, input: input)
+        }
+    }
+
+    /// Free on-demand document.
+    ///
+    /// - Parameter docPtr: Pointer to GblnDoc to free
+    static func docFree(_ docPtr: OpaquePointer) {
+        gbln_doc_free(docPtr)
+    }
+
+    // MARK: - Schema Decoding
+
+    /// Compile a decoding schema.
+    ///
+    /// Calls C function: `gbln_schema_compile(const GblnSchemaField* fields, size_t count, GblnSchema** out_schema)`
+    ///
+    /// - Parameter fields: Field descriptions (path strings only need to live for this call)
+    /// - Returns: Opaque pointer to GblnSchema (caller owns, must free with `schemaFree`)
+    /// - Throws: `GblnError.validationError` if the field descriptions are invalid
+    static func schemaCompile(_ fields: [GblnSchemaField]) throws -> OpaquePointer {
+        var outSchema: OpaquePointer?
+
+        let result = fields.withUnsafeBufferPointer { buffer in
+            gbln_schema_compile(buffer.baseAddress, UInt(buffer.count), &outSchema)
+        }
+
+        guard result == Ok else {
+            throw GblnError.validationError(getErrorMessage())
+        }
+
+        guard let schemaPtr = outSchema else {
+            throw GblnError.validationError("Schema compile returned null pointer")
+        }
+
+        return schemaPtr
+    }
+
+    /// Decode GBLN bytes directly into caller memory.
+    ///
+    /// Calls C function: `gbln_decode_into_err(const GblnSchema* schema, const uint8_t* input, size_t len, void* out_struct, GblnErrorInfo* out_error)`
+    ///
+    /// - Parameters:
+    ///   - schemaPtr: Pointer to GblnSchema
+    ///   - buffer: UTF-8 encoded GBLN bytes
+    ///   - out: Target memory covering every field of the schema
+    /// - Throws: `GblnError.parseFailure` if the input is invalid or does not match the schema
+    static func decodeInto(_ schemaPtr: OpaquePointer, bytes buffer: UnsafeRawBufferPointer, out: UnsafeMutableRawPointer) throws {
+        var error = GblnErrorInfo()
+
+        let bytes = buffer.baseAddress?.assumingMemoryBound(to: UInt8.self)
+        let result = gbln_decode_into_err(schemaPtr, bytes, UInt(buffer.count), out, &error)
+
+        guard result == Ok else {
+            throw parseFailure(error, input: buffer)
+        }
+    }
+
+    /// Free decoding schema.
+    ///
+    /// - Parameter schemaPtr: Pointer to GblnSchema to free
+    static func schemaFree(_ schemaPtr: OpaquePointer) {
+        gbln_schema_free(schemaPtr)
+    }
+
     // MARK: - Serialise
 
     /// Serialise GBLN value to MINI string.
@@ -117,6 +790,17 @@ internal enum FFI {
         gbln_value_free(valuePtr)
     }
 
+    /// Free array of GBLN values.
+    ///
+    /// Calls C function: `gbln_values_free(GblnValue** values, size_t count)`
+    ///
+    /// - Parameters:
+    ///   - values: Array returned from `parseStreamBatch`
+    ///   - count: Number of values in the array
+    static func freeValues(_ values: UnsafeMutablePointer<OpaquePointer?>?, count: Int) {
+        gbln_values_free(values, UInt(count))
+    }
+
     // MARK: - Type Introspection
 
     /// Get value type.
@@ -256,15 +940,17 @@ internal enum FFI {
     }
 
     /// Extract string value.
+    ///
+    /// Reads the value's UTF-8 storage in place via `gbln_value_as_str_ref`
+    /// and builds the Swift `String` from it in a single copy; no C string
+    /// is allocated or freed.
     static func asString(_ valuePtr: OpaquePointer) throws -> String {
-        var ok: Bool = false
-        guard let strPtr = gbln_value_as_string(valuePtr, &ok) else {
+        var len: UInt = 0
+        guard let bytesPtr = gbln_value_as_str_ref(valuePtr, &len) else {
             throw GblnError.parseError("Value is not a string")
         }
 
-        defer { gbln_string_free(strPtr) }
-
-        return String(cString: strPtr)
+        return String(decoding: UnsafeBufferPointer(start: bytesPtr, count: Int(len)), as: UTF8.self)
     }
 
     /// Extract bool value.
@@ -327,6 +1013,29 @@ internal enum FFI {
         return keys
     }
 
+    /// Get object entry by index in document order.
+    ///
+    /// Calls C function: `gbln_object_entry_at(const GblnValue* value, size_t index, const uint8_t** out_key, size_t* out_key_len)`
+    ///
+    /// The key is returned as borrowed bytes; no key array is allocated.
+    /// For objects bound to a key table the bytes are the interned copy.
+    ///
+    /// - Parameters:
+    ///   - valuePtr: Pointer to object value
+    ///   - index: Entry index
+    /// - Returns: Key bytes (valid as long as the object) and pointer to field value, or nil if out of bounds
+    static func objectEntry(_ valuePtr: OpaquePointer, at index: Int) -> (key: UnsafeBufferPointer<UInt8>, value: OpaquePointer)? {
+        var keyPtr: UnsafePointer<UInt8>?
+        var keyLen: UInt = 0
+
+        guard let fieldPtr = gbln_object_entry_at(valuePtr, UInt(index), &keyPtr, &keyLen),
+              let keyBytes = keyPtr else {
+            return nil
+        }
+
+        return (UnsafeBufferPointer(start: keyBytes, count: Int(keyLen)), fieldPtr)
+    }
+
     // MARK: - Array Operations
 
     /// Get array length.
@@ -344,11 +1053,73 @@ internal enum FFI {
         return gbln_array_get(valuePtr, UInt(index))
     }
 
+    /// Signature shared by the `gbln_array_as_*_slice` functions.
+    typealias ArraySliceAccessor<T> = (OpaquePointer?, UnsafeMutablePointer<UInt>?) -> UnsafePointer<T>?
+
+    /// Get element type of a packed scalar array.
+    ///
+    /// Calls C function: `gbln_array_element_type(const GblnValue* value)`
+    ///
+    /// - Parameter valuePtr: Pointer to array value
+    /// - Returns: Element type, or `Null` if the array is not packed
+    static func arrayElementType(_ valuePtr: OpaquePointer) -> GblnValueType {
+        return gbln_array_element_type(valuePtr)
+    }
+
+    /// Get elements of a packed scalar array without copying.
+    ///
+    /// Calls one of the C functions `gbln_array_as_*_slice(const GblnValue* value, size_t* out_len)`.
+    ///
+    /// - Parameters:
+    ///   - valuePtr: Pointer to array value
+    ///   - accessor: Slice function matching the element type, e.g. `gbln_array_as_f64_slice`
+    /// - Returns: Buffer borrowed from the array (valid while the array is), or nil if not packed with that type
+    static func arraySlice<T>(_ valuePtr: OpaquePointer, _ accessor: ArraySliceAccessor<T>) -> UnsafeBufferPointer<T>? {
+        var count: UInt = 0
+
+        guard let elements = accessor(valuePtr, &count) else {
+            return nil
+        }
+
+        return UnsafeBufferPointer(start: elements, count: Int(count))
+    }
+
+    /// Signature shared by the `gbln_array_copy_*` functions.
+    typealias ArrayCopier<T> = (OpaquePointer?, UnsafeMutablePointer<T>?, UInt) -> GblnErrorCode
+
+    /// Copy all elements of an array into a Swift array in one call.
+    ///
+    /// Calls one of the C functions `gbln_array_copy_*(const GblnValue* value, T* out, size_t n)`.
+    ///
+    /// - Parameters:
+    ///   - valuePtr: Pointer to array value
+    ///   - copier: Copy function for the element type, e.g. `gbln_array_copy_f64`
+    /// - Returns: Copied elements
+    /// - Throws: `GblnError.parseError` if the value is not an array or an element cannot be converted
+    static func arrayCopy<T>(_ valuePtr: OpaquePointer, _ copier: ArrayCopier<T>) throws -> [T] {
+        let count = arrayLen(valuePtr)
+        var result = Ok
+
+        let elements = [T](unsafeUninitializedCapacity: count) { buffer, initializedCount in
+            result = copier(valuePtr, buffer.baseAddress, UInt(count))
+            initializedCount = result == Ok ? count : 0
+        }
+
+        guard result == Ok else {
+            if result == ErrorIntOutOfRange {
+                throw GblnError.parseError("Array element out of range for \(T.self)")
+            }
+            throw GblnError.parseError("Array elements cannot be read as \(T.self)")
+        }
+
+        return elements
+    }
+
     // MARK: - I/O Operations
 
     /// Write value to I/O format file.
     ///
-    /// Calls C function: `gbln_write_io(const GblnValue* value, const char* path, const GblnConfig* config)`
+    /// Calls C function: `gbln_write_io_err(const GblnValue* value, const char* path, const GblnConfig* config, GblnErrorInfo* out_error)`
     ///
     /// - Parameters:
     ///   - valuePtr: Pointer to GblnValue
@@ -356,33 +1127,62 @@ internal enum FFI {
     ///   - configPtr: Pointer to GblnConfig (or nil for default)
     /// - Throws: `GblnError.ioError` if write fails
     static func writeIo(_ valuePtr: OpaquePointer, path: String, configPtr: OpaquePointer?) throws {
+        var error = GblnErrorInfo()
+
         let result = path.withCString { pathCStr in
-            gbln_write_io(valuePtr, pathCStr, configPtr)
+            gbln_write_io_err(valuePtr, pathCStr, configPtr, &error)
         }
 
         guard result == Ok else {
-            let errorMsg = getErrorMessage()
-            throw GblnError.ioError(errorMsg)
+            throw GblnError.ioError(ioErrorMessage(error, path: path))
         }
     }
 
     /// Read value from I/O format file.
     ///
-    /// Calls C function: `gbln_read_io(const char* path, GblnValue** out_value)`
+    /// Calls C function: `gbln_read_io_err(const char* path, GblnValue** out_value, GblnErrorInfo* out_error)`
     ///
     /// - Parameter path: Input file path
     /// - Returns: Opaque pointer to GblnValue (caller owns, must free)
     /// - Throws: `GblnError.ioError` if read fails
     static func readIo(path: String) throws -> OpaquePointer {
         var outValue: OpaquePointer?
+        var error = GblnErrorInfo()
+
+        let result = path.withCString { pathCStr in
+            gbln_read_io_err(pathCStr, &outValue, &error)
+        }
+
+        guard result == Ok else {
+            throw GblnError.ioError(ioErrorMessage(error, path: path))
+        }
+
+        guard let valuePtr = outValue else {
+            throw GblnError.ioError("Read returned null pointer")
+        }
+
+        return valuePtr
+    }
+
+    /// Read value from I/O format file, parsing on multiple threads.
+    ///
+    /// Calls C function: `gbln_read_io_parallel_err(const char* path, size_t nthreads, GblnValue** out_value, GblnErrorInfo* out_error)`
+    ///
+    /// - Parameters:
+    ///   - path: Input file path
+    ///   - threads: Maximum number of worker threads (0 = one per core)
+    /// - Returns: Opaque pointer to GblnValue (caller owns, must free)
+    /// - Throws: `GblnError.ioError` if read fails
+    static func readIo(path: String, threads: Int) throws -> OpaquePointer {
+        var outValue: OpaquePointer?
+        var error = GblnErrorInfo()
 
         let result = path.withCString { pathCStr in
-            gbln_read_io(pathCStr, &outValue)
+            gbln_read_io_parallel_err(pathCStr, UInt(threads), &outValue, &error)
         }
 
         guard result == Ok else {
-            let errorMsg = getErrorMessage()
-            throw GblnError.ioError(errorMsg)
+            throw GblnError.ioError(ioErrorMessage(error, path: path))
         }
 
         guard let valuePtr = outValue else {
@@ -61,10 +61,24 @@ import Foundation
 /// - `parse(_:)` - Parse GBLN string to Swift value
 /// - `parseFile(at:)` - Parse GBLN file to Swift value
 /// - `parseFileAsync(at:)` - Async file parsing
-/// - `toString(_:mini:)` - Serialise Swift value to GBLN
+/// - `parseMini(_:)` - Parse machine-written MINI GBLN on a specialised fast path
+/// - `parseParallel(_:threads:)` - Parse large documents on multiple cores
+/// - `parseRecords(_:threads:)` - Parse a newline-delimited stream of records
+/// - `validate(_:)` - Check a document without building a value
+/// - `isValid(_:)` - Check a document without building a value or error text
+/// - `extract(_:from:)` - Read one value by dot-separated path
+/// - `GblnParser` - Reusable parser that keeps its buffers between parses
+/// - `GblnKeyTable` - Shared, thread-safe table of interned object keys
+/// - `GblnDocument` - On-demand document that decodes only the paths you read
+/// - `GblnPushParser` - Incremental parser for chunked input, reports `GblnStreamEvent`s
+/// - `GblnReader` - Pull-based event reader over buffers or files, in constant memory
+/// - `GblnSchema` - Precompiled schema that decodes fixed-shape documents into structs
+/// - `toString(_:mini:keyTable:)` - Serialise Swift value to GBLN
 /// - `toStringPretty(_:indent:)` - Pretty-print GBLN
+/// - `toRecordLine(_:keyTable:)` - Serialise one line of a record stream
 /// - `writeIo(_:to:config:)` - Write I/O format file
 /// - `readIo(from:)` - Read I/O format file
+/// - `readIo(from:threads:)` - Read I/O format file, parsing on multiple cores
 /// - `writeIoAsync(_:to:config:)` - Async I/O write
 /// - `readIoAsync(from:)` - Async I/O read
 ///
@@ -72,6 +86,7 @@ import Foundation
 ///
 /// - `GblnConfig` - I/O format configuration (MINI mode, compression, etc.)
 /// - `GblnError` - Error types for parsing, validation, I/O, and serialisation
+/// - `GblnParseFailure` - Code and location of a parse failure, with lazily rendered text
 ///
 /// # References
 ///
@@ -84,4 +99,12 @@ public struct GBLN {
 
     /// GBLN specification version.
     public static let specVersion = "1.0.0"
+
+    /// Structural scanner backend used by the parser on this CPU.
+    ///
+    /// One of `scalar`, `sse42`, `avx2` or `neon`. Bulk-ingest jobs can
+    /// log this to confirm they run on the vectorised scanner.
+    public static var scannerBackend: String {
+        FFI.scannerBackend()
+    }
 }
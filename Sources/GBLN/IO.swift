@@ -94,6 +94,28 @@ public func readIo(from path: String) throws -> Any {
     return result
 }
 
+/// Read Swift value from I/O format file, parsing on multiple threads.
+///
+/// Like `readIo(from:)`, but large top-level arrays and objects are split
+/// at element boundaries and parsed on several cores.
+///
+/// # Examples
+///
+/// ```swift
+/// // Use every core for a nightly snapshot
+/// let snapshot = try readIo(from: "snapshot.io.gbln.xz", threads: 0)
+/// ```
+///
+/// - Parameters:
+///   - path: Input file path
+///   - threads: Maximum number of worker threads (0 = one per core)
+/// - Returns: Swift value (Dictionary, Array, or primitive)
+/// - Throws: `GblnError.ioError` if read fails, or `GblnError.parseError` if invalid GBLN
+public func readIo(from path: String, threads: Int) throws -> Any {
+    let valuePtr = try FFI.readIo(path: path, threads: max(threads, 0))
+    return try convertParsedValue(valuePtr)
+}
+
 /// Write Swift value to I/O format file (asynchronous).
 ///
 /// Async variant of `writeIo(_:to:config:)` that can be called from async contexts.
@@ -0,0 +1,84 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+import Foundation
+
+/// Shared table of interned object keys.
+///
+/// Parsers bound to the same table store each distinct object key once,
+/// rather than once per document. Workloads that keep many small documents
+/// with the same few keys, such as caches of parsed records, then share a
+/// single allocation per key, and key lookups compare pointers.
+///
+/// A key table is thread-safe: parsers on different threads may share one.
+/// It stays alive for as long as any parser bound to it, even after the
+/// last `GblnKeyTable` reference is released.
+///
+/// Interning also reaches the converted values: dictionaries produced by
+/// bound parsers share one Swift `String` per distinct key. Passing the
+/// table to `toString(_:mini:keyTable:)` interns the keys of the values
+/// built for serialisation as well.
+///
+/// # Examples
+///
+/// ```swift
+/// let keys = try GblnKeyTable()
+///
+/// // One parser per worker, all sharing the same keys
+/// let parser = try GblnParser(keyTable: keys)
+/// let value = try parser.parse(message)
+/// ```
+public final class GblnKeyTable {
+    internal let ptr: OpaquePointer
+
+    /// Swift strings of the keys interned so far.
+    internal let strings = GblnKeyStrings()
+
+    /// Create empty key table.
+    ///
+    /// - Throws: `GblnError.parseError` if the table cannot be created
+    public init() throws {
+        self.ptr = try FFI.keyTableNew()
+    }
+
+    /// Release this reference to the table.
+    deinit {
+        FFI.keyTableFree(ptr)
+    }
+
+    /// Number of distinct keys interned so far.
+    public var count: Int {
+        return FFI.keyTableCount(ptr)
+    }
+}
+
+/// Swift strings for the keys of one key table.
+///
+/// Interned keys keep their address for the lifetime of the table, so the
+/// address identifies the key. Each key is decoded into a `String` once and
+/// the same string is handed out for every later occurrence.
+internal final class GblnKeyStrings {
+    private let lock = NSLock()
+    private var strings: [UnsafeRawPointer: String] = [:]
+
+    /// Get the string for an interned key.
+    ///
+    /// - Parameter key: Key bytes owned by the table
+    /// - Returns: Shared string for the key
+    func string(for key: UnsafeBufferPointer<UInt8>) -> String {
+        guard let address = key.baseAddress.map(UnsafeRawPointer.init) else {
+            return ""
+        }
+
+        lock.lock()
+        defer { lock.unlock() }
+
+        if let string = strings[address] {
+            return string
+        }
+
+        let string = String(decoding: key, as: UTF8.self)
+        strings[address] = string
+        return string
+    }
+}
@@ -35,9 +35,429 @@ import Foundation
 ///
 /// - Parameter gblnString: GBLN-formatted string
 /// - Returns: Swift value (Dictionary, Array, or primitive)
-/// - Throws: `GblnError.parseError` if parsing fails
+/// - Throws: `GblnError.parseFailure` if parsing fails
 public func parse(_ gblnString: String) throws -> Any {
     let valuePtr = try FFI.parse(gblnString)
+    return try convertParsedValue(valuePtr)
+}
+
+/// Parse GBLN from a raw UTF-8 byte buffer.
+///
+/// The buffer is parsed in place; it does not need to be null-terminated
+/// and is not copied into a `String` first. Use this to parse directly
+/// out of socket or file buffers.
+///
+/// # Examples
+///
+/// ```swift
+/// let value = try bytes.withUnsafeBytes { buffer in
+///     try parse(buffer)
+/// }
+/// ```
+///
+/// - Parameter buffer: UTF-8 encoded GBLN bytes
+/// - Returns: Swift value (Dictionary, Array, or primitive)
+/// - Throws: `GblnError.parseFailure` if parsing fails
+public func parse(_ buffer: UnsafeRawBufferPointer) throws -> Any {
+    let valuePtr = try FFI.parse(bytes: buffer)
+    return try convertParsedValue(valuePtr)
+}
+
+/// Parse GBLN from UTF-8 encoded `Data`.
+///
+/// # Examples
+///
+/// ```swift
+/// let data = try Data(contentsOf: url)
+/// let value = try parse(data)
+/// ```
+///
+/// - Parameter data: UTF-8 encoded GBLN bytes
+/// - Returns: Swift value (Dictionary, Array, or primitive)
+/// - Throws: `GblnError.parseFailure` if parsing fails
+public func parse(_ data: Data) throws -> Any {
+    return try data.withUnsafeBytes { buffer in
+        try parse(buffer)
+    }
+}
+
+/// Parse GBLN from a UTF-8 encoded byte array.
+///
+/// - Parameter bytes: UTF-8 encoded GBLN bytes
+/// - Returns: Swift value (Dictionary, Array, or primitive)
+/// - Throws: `GblnError.parseFailure` if parsing fails
+public func parse(_ bytes: [UInt8]) throws -> Any {
+    return try bytes.withUnsafeBytes { buffer in
+        try parse(buffer)
+    }
+}
+
+/// Extract a single value from GBLN bytes by path.
+///
+/// Reads the input once and converts only the addressed value; sibling
+/// subtrees are skipped without being materialised. Use this when only one
+/// or two fields of a message are needed. For several fields of the same
+/// document, `GblnDocument` avoids rescanning the input.
+///
+/// Path segments are separated by `.` and resolved like
+/// `GblnDocument.value(at:)`: a segment applied to an object is a key, one
+/// applied to an array is a decimal index. Write `.` and `\` inside keys as
+/// `\.` and `\\`, or pass the segments as an array to have them escaped.
+/// An empty path extracts the whole document.
+///
+/// # Examples
+///
+/// ```swift
+/// let userId = try extract("response.data.user.id", from: message) as? Int
+/// let firstName = try extract("users.0.name", from: message) as? String
+/// let port = try extract(["server.v2", "port"], from: message) as? Int
+/// ```
+///
+/// - Parameters:
+///   - path: Dot-separated path, e.g. `response.data.user.id`
+///   - buffer: UTF-8 encoded GBLN bytes
+/// - Returns: Swift value, or `nil` if the path does not exist or addresses GBLN null
+/// - Throws: `GblnError.parseFailure` if the input is invalid
+public func extract(_ path: String, from buffer: UnsafeRawBufferPointer) throws -> Any? {
+    guard let valuePtr = try FFI.extract(bytes: buffer, path: path) else {
+        return nil
+    }
+
+    let managed = ManagedValue(valuePtr)
+    return try gblnToSwift(managed.pointer)
+}
+
+/// Extract a single value from UTF-8 encoded GBLN `Data` by path.
+///
+/// - Parameters:
+///   - path: Dot-separated path, e.g. `response.data.user.id`
+///   - data: UTF-8 encoded GBLN bytes
+/// - Returns: Swift value, or `nil` if the path does not exist or addresses GBLN null
+/// - Throws: `GblnError.parseFailure` if the input is invalid
+public func extract(_ path: String, from data: Data) throws -> Any? {
+    return try data.withUnsafeBytes { buffer in
+        try extract(path, from: buffer)
+    }
+}
+
+/// Extract a single value from a GBLN string by path.
+///
+/// - Parameters:
+///   - path: Dot-separated path, e.g. `response.data.user.id`
+///   - gblnString: GBLN-formatted string
+/// - Returns: Swift value, or `nil` if the path does not exist or addresses GBLN null
+/// - Throws: `GblnError.parseFailure` if the input is invalid
+public func extract(_ path: String, from gblnString: String) throws -> Any? {
+    var gblnString = gblnString
+
+    return try gblnString.withUTF8 { utf8 in
+        try extract(path, from: UnsafeRawBufferPointer(utf8))
+    }
+}
+
+/// Extract a single value from GBLN bytes by path segments.
+///
+/// Segments are escaped and joined, so keys may contain `.` and `\`.
+///
+/// - Parameters:
+///   - path: Object keys and array indices, outermost first
+///   - buffer: UTF-8 encoded GBLN bytes
+/// - Returns: Swift value, or `nil` if the path does not exist or addresses GBLN null
+/// - Throws: `GblnError.parseFailure` if the input is invalid
+public func extract(_ path: [String], from buffer: UnsafeRawBufferPointer) throws -> Any? {
+    return try extract(joinPath(path), from: buffer)
+}
+
+/// Extract a single value from UTF-8 encoded GBLN `Data` by path segments.
+///
+/// - Parameters:
+///   - path: Object keys and array indices, outermost first
+///   - data: UTF-8 encoded GBLN bytes
+/// - Returns: Swift value, or `nil` if the path does not exist or addresses GBLN null
+/// - Throws: `GblnError.parseFailure` if the input is invalid
+public func extract(_ path: [String], from data: Data) throws -> Any? {
+    return try extract(joinPath(path), from: data)
+}
+
+/// Extract a single value from a GBLN string by path segments.
+///
+/// - Parameters:
+///   - path: Object keys and array indices, outermost first
+///   - gblnString: GBLN-formatted string
+/// - Returns: Swift value, or `nil` if the path does not exist or addresses GBLN null
+/// - Throws: `GblnError.parseFailure` if the input is invalid
+public func extract(_ path: [String], from gblnString: String) throws -> Any? {
+    return try extract(joinPath(path), from: gblnString)
+}
+
+/// Join path segments into the dotted path syntax, escaping `\` and `.`.
+///
+/// - Parameter segments: Object keys and array indices, outermost first
+/// - Returns: Dot-separated path
+private func joinPath(_ segments: [String]) -> String {
+    return segments.map { segment in
+        segment
+            .replacingOccurrences(of: "\\", with: "\\\\")
+            .replacingOccurrences(of: ".", with: "\\.")
+    }.joined(separator: ".")
+}
+
+/// Validate GBLN bytes without building a value.
+///
+/// Performs the same checks as `parse(_:)` (syntax, type hints, integer
+/// ranges, string lengths, duplicate keys) without allocating a value tree
+/// or converting anything to Swift. Use this to reject bad documents cheaply
+/// before accepting them.
+///
+/// # Examples
+///
+/// ```swift
+/// do {
+///     try validate(payload)
+///     queue.enqueue(payload)
+/// } catch {
+///     reject(payload, reason: error.localizedDescription)
+/// }
+/// ```
+///
+/// - Parameter buffer: UTF-8 encoded GBLN bytes
+/// - Throws: `GblnError.parseFailure` describing the first problem found
+public func validate(_ buffer: UnsafeRawBufferPointer) throws {
+    try FFI.validate(bytes: buffer)
+}
+
+/// Validate UTF-8 encoded GBLN `Data` without building a value.
+///
+/// - Parameter data: UTF-8 encoded GBLN bytes
+/// - Throws: `GblnError.parseFailure` describing the first problem found
+public func validate(_ data: Data) throws {
+    try data.withUnsafeBytes { buffer in
+        try validate(buffer)
+    }
+}
+
+/// Validate a GBLN string without building a value.
+///
+/// - Parameter gblnString: GBLN-formatted string
+/// - Throws: `GblnError.parseFailure` describing the first problem found
+public func validate(_ gblnString: String) throws {
+    var gblnString = gblnString
+
+    try gblnString.withUTF8 { utf8 in
+        try validate(UnsafeRawBufferPointer(utf8))
+    }
+}
+
+/// Check GBLN bytes without building a value.
+///
+/// Runs the same checks as `validate(_:)`, but builds no error value, so
+/// rejecting input costs no more than accepting it. Use this on hot paths
+/// where most inputs are expected to be invalid; use `validate(_:)` when
+/// the location of the failure is needed.
+///
+/// - Parameter buffer: UTF-8 encoded GBLN bytes
+/// - Returns: `true` if the input is valid GBLN
+public func isValid(_ buffer: UnsafeRawBufferPointer) -> Bool {
+    return FFI.isValid(bytes: buffer)
+}
+
+/// Check UTF-8 encoded GBLN `Data` without building a value.
+///
+/// - Parameter data: UTF-8 encoded GBLN bytes
+/// - Returns: `true` if the input is valid GBLN
+public func isValid(_ data: Data) -> Bool {
+    return data.withUnsafeBytes { buffer in
+        isValid(buffer)
+    }
+}
+
+/// Check a GBLN string without building a value.
+///
+/// - Parameter gblnString: GBLN-formatted string
+/// - Returns: `true` if the input is valid GBLN
+public func isValid(_ gblnString: String) -> Bool {
+    var gblnString = gblnString
+
+    return gblnString.withUTF8 { utf8 in
+        isValid(UnsafeRawBufferPointer(utf8))
+    }
+}
+
+/// Parse MINI GBLN from a raw UTF-8 byte buffer.
+///
+/// MINI GBLN, as written by `toString(_:mini:)` and by `writeIo` with
+/// `GblnConfig.io`, has no whitespace between tokens and no comments. This
+/// parser is specialised for it and skips all whitespace and comment
+/// handling, so it is the fastest way to read machine-written input.
+///
+/// `parse(_:)` and `parseFile(at:)` detect MINI input on their own and
+/// switch to the same parser; use this function when the input is known
+/// to be MINI to skip that check as well.
+///
+/// # Examples
+///
+/// ```swift
+/// let value = try parseMini(Data("user{id<u32>(1)tags<s16>[a b]}".utf8))
+/// ```
+///
+/// - Parameter buffer: UTF-8 encoded MINI GBLN bytes
+/// - Returns: Swift value (Dictionary, Array, or primitive)
+/// - Throws: `GblnError.parseFailure` if parsing fails, including on whitespace or comments outside MINI syntax
+public func parseMini(_ buffer: UnsafeRawBufferPointer) throws -> Any {
+    let valuePtr = try FFI.parseMini(bytes: buffer)
+    return try convertParsedValue(valuePtr)
+}
+
+/// Parse MINI GBLN from UTF-8 encoded `Data`.
+///
+/// - Parameter data: UTF-8 encoded MINI GBLN bytes
+/// - Returns: Swift value (Dictionary, Array, or primitive)
+/// - Throws: `GblnError.parseFailure` if parsing fails or the input is not MINI GBLN
+public func parseMini(_ data: Data) throws -> Any {
+    return try data.withUnsafeBytes { buffer in
+        try parseMini(buffer)
+    }
+}
+
+/// Parse a MINI GBLN string.
+///
+/// - Parameter gblnString: MINI GBLN-formatted string
+/// - Returns: Swift value (Dictionary, Array, or primitive)
+/// - Throws: `GblnError.parseFailure` if parsing fails or the input is not MINI GBLN
+public func parseMini(_ gblnString: String) throws -> Any {
+    var gblnString = gblnString
+
+    return try gblnString.withUTF8 { utf8 in
+        try parseMini(UnsafeRawBufferPointer(utf8))
+    }
+}
+
+/// Parse GBLN from a raw UTF-8 byte buffer on multiple threads.
+///
+/// Large top-level arrays and objects (such as a snapshot file holding one
+/// huge `records[...]` array) are split at element boundaries and parsed on
+/// several cores. Small inputs are parsed on the calling thread.
+///
+/// # Examples
+///
+/// ```swift
+/// let snapshot = try Data(contentsOf: snapshotURL)
+/// let value = try parseParallel(snapshot)
+/// ```
+///
+/// - Parameters:
+///   - buffer: UTF-8 encoded GBLN bytes
+///   - threads: Maximum number of worker threads (default: 0, one per core)
+/// - Returns: Swift value (Dictionary, Array, or primitive)
+/// - Throws: `GblnError.parseFailure` if parsing fails
+public func parseParallel(_ buffer: UnsafeRawBufferPointer, threads: Int = 0) throws -> Any {
+    let valuePtr = try FFI.parseParallel(bytes: buffer, threads: max(threads, 0))
+    return try convertParsedValue(valuePtr)
+}
+
+/// Parse GBLN from UTF-8 encoded `Data` on multiple threads.
+///
+/// - Parameters:
+///   - data: UTF-8 encoded GBLN bytes
+///   - threads: Maximum number of worker threads (default: 0, one per core)
+/// - Returns: Swift value (Dictionary, Array, or primitive)
+/// - Throws: `GblnError.parseFailure` if parsing fails
+public func parseParallel(_ data: Data, threads: Int = 0) throws -> Any {
+    return try data.withUnsafeBytes { buffer in
+        try parseParallel(buffer, threads: threads)
+    }
+}
+
+/// Parse a newline-delimited stream of GBLN records.
+///
+/// A record stream holds one MINI GBLN document per line, as written by
+/// `toRecordLine(_:)`. Empty lines are skipped. All records are parsed in
+/// one call, across a pool of worker threads, and returned in stream order;
+/// top-level GBLN null records become `NSNull`.
+///
+/// Records are framed by raw line feeds, which MINI GBLN does not escape,
+/// so string values in a record must not contain `"\n"`. `toRecordLine(_:)`
+/// rejects such records when they are written.
+///
+/// # Examples
+///
+/// ```swift
+/// // Append one record per event
+/// let line = try toRecordLine(event)
+/// try handle.write(contentsOf: Data(line.utf8))
+///
+/// // Later: parse the whole log at once
+/// let events = try parseRecords(Data(contentsOf: logURL))
+/// ```
+///
+/// - Parameters:
+///   - buffer: UTF-8 encoded record stream
+///   - threads: Maximum number of worker threads (default: 0, one per core)
+/// - Returns: Swift values, one per record
+/// - Throws: `GblnError.parseFailure` if any record fails to parse, including
+///   a record split by a line feed inside a string value; never returns fewer
+///   values than there are non-empty lines
+public func parseRecords(_ buffer: UnsafeRawBufferPointer, threads: Int = 0) throws -> [Any] {
+    let batch = try FFI.parseStreamBatch(bytes: buffer, threads: max(threads, 0))
+
+    defer { FFI.freeValues(batch.values, count: batch.count) }
+
+    guard let values = batch.values else {
+        guard batch.count == 0 else {
+            throw GblnError.parseError("Record batch of \(batch.count) records returned null pointer")
+        }
+        return []
+    }
+
+    var records: [Any] = []
+    records.reserveCapacity(batch.count)
+
+    for i in 0..<batch.count {
+        // Empty lines are not counted, so every slot holds a record
+        guard let valuePtr = values[i] else {
+            throw GblnError.parseError("Record \(i) of batch returned null pointer")
+        }
+
+        records.append(try gblnToSwift(valuePtr) ?? NSNull())
+    }
+
+    return records
+}
+
+/// Parse a newline-delimited stream of GBLN records from `Data`.
+///
+/// - Parameters:
+///   - data: UTF-8 encoded record stream
+///   - threads: Maximum number of worker threads (default: 0, one per core)
+/// - Returns: Swift values, one per record
+/// - Throws: `GblnError.parseFailure` if any record fails to parse
+public func parseRecords(_ data: Data, threads: Int = 0) throws -> [Any] {
+    return try data.withUnsafeBytes { buffer in
+        try parseRecords(buffer, threads: threads)
+    }
+}
+
+/// Parse a newline-delimited stream of GBLN records from a string.
+///
+/// - Parameters:
+///   - gblnString: Record stream, one MINI GBLN document per line
+///   - threads: Maximum number of worker threads (default: 0, one per core)
+/// - Returns: Swift values, one per record
+/// - Throws: `GblnError.parseFailure` if any record fails to parse
+public func parseRecords(_ gblnString: String, threads: Int = 0) throws -> [Any] {
+    var gblnString = gblnString
+
+    return try gblnString.withUTF8 { utf8 in
+        try parseRecords(UnsafeRawBufferPointer(utf8), threads: threads)
+    }
+}
+
+/// Convert a freshly parsed value to Swift and free it.
+///
+/// - Parameter valuePtr: Opaque pointer to parsed GblnValue (ownership is taken)
+/// - Returns: Swift value, with top-level GBLN null mapped to `NSNull`
+/// - Throws: `GblnError.parseError` if conversion fails
+internal func convertParsedValue(_ valuePtr: OpaquePointer) throws -> Any {
     let managed = ManagedValue(valuePtr)
 
     guard let result = try gblnToSwift(managed.pointer) else {
@@ -50,8 +470,10 @@ public func parse(_ gblnString: String) throws -> Any {
 
 /// Parse GBLN file to Swift value (synchronous).
 ///
-/// Reads a `.gbln` file and parses its content.
-/// For I/O format files (`.io.gbln.xz`), use `readIo()` instead.
+/// Memory-maps a `.gbln` or `.io.gbln` file and parses it directly from
+/// the mapping, without reading it into an intermediate buffer first.
+/// XZ-compressed I/O format files (`.io.gbln.xz`) are detected by their
+/// magic bytes and decompressed first, exactly as `readIo(from:)` does.
 ///
 /// # Examples
 ///
@@ -67,16 +489,10 @@ public func parse(_ gblnString: String) throws -> Any {
 ///
 /// - Parameter path: File path (absolute or relative)
 /// - Returns: Swift value (Dictionary, Array, or primitive)
-/// - Throws: `GblnError.parseError` if parsing fails, or `GblnError.ioError` if file read fails
+/// - Throws: `GblnError.parseFailure` if parsing fails, or `GblnError.ioError` if file read fails
 public func parseFile(at path: String) throws -> Any {
-    do {
-        let content = try String(contentsOfFile: path, encoding: .utf8)
-        return try parse(content)
-    } catch let error as GblnError {
-        throw error
-    } catch {
-        throw GblnError.ioError("Failed to read file '\(path)': \(error.localizedDescription)")
-    }
+    let valuePtr = try FFI.parseFile(path: path)
+    return try convertParsedValue(valuePtr)
 }
 
 /// Parse GBLN file to Swift value (asynchronous).
@@ -94,7 +510,7 @@ public func parseFile(at path: String) throws -> Any {
 ///
 /// - Parameter path: File path (absolute or relative)
 /// - Returns: Swift value (Dictionary, Array, or primitive)
-/// - Throws: `GblnError.parseError` if parsing fails, or `GblnError.ioError` if file read fails
+/// - Throws: `GblnError.parseFailure` if parsing fails, or `GblnError.ioError` if file read fails
 public func parseFileAsync(at path: String) async throws -> Any {
     return try parseFile(at: path)
 }
@@ -0,0 +1,106 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+import Foundation
+
+/// Reusable GBLN parser that keeps its buffers between parses.
+///
+/// Each call to the free `parse(_:)` function starts with a cold parser.
+/// A `GblnParser` instead retains its token stack, scratch buffers and
+/// document arena across calls, so a long-lived worker parsing many small
+/// messages stops allocating inside libgbln once it reaches a steady state.
+///
+/// A parser is not thread-safe. Use one instance per thread or task.
+///
+/// # Examples
+///
+/// ```swift
+/// let parser = try GblnParser()
+///
+/// for message in messages {
+///     let value = try parser.parse(message)
+///     handle(value)
+/// }
+/// ```
+public final class GblnParser {
+    private let ptr: OpaquePointer
+
+    /// Key strings of the bound key table, if any.
+    ///
+    /// The C parser holds its own reference to the table, which keeps the
+    /// interned keys, and so the cached strings' addresses, valid.
+    private let keyStrings: GblnKeyStrings?
+
+    /// Create parser context.
+    ///
+    /// - Parameter keyTable: Shared table to intern object keys in (default: none)
+    /// - Throws: `GblnError.parseError` if the context cannot be created or bound to the table
+    public init(keyTable: GblnKeyTable? = nil) throws {
+        self.ptr = try FFI.parserNew()
+        self.keyStrings = keyTable?.strings
+
+        if let keyTable = keyTable {
+            try FFI.parserSetKeyTable(ptr, keyTable.ptr)
+        }
+    }
+
+    /// Free the parser context and all retained buffers.
+    deinit {
+        FFI.parserFree(ptr)
+    }
+
+    /// Parse GBLN from a raw UTF-8 byte buffer.
+    ///
+    /// - Parameter buffer: UTF-8 encoded GBLN bytes
+    /// - Returns: Swift value (Dictionary, Array, or primitive)
+    /// - Throws: `GblnError.parseFailure` if parsing fails
+    public func parse(_ buffer: UnsafeRawBufferPointer) throws -> Any {
+        let valuePtr = try FFI.parserParse(ptr, bytes: buffer)
+
+        // The document lives in the parser's arena; it is reused by the next parse
+        return try gblnToSwift(valuePtr, keys: keyStrings) ?? NSNull()
+    }
+
+    /// Parse GBLN string.
+    ///
+    /// - Parameter gblnString: GBLN-formatted string
+    /// - Returns: Swift value (Dictionary, Array, or primitive)
+    /// - Throws: `GblnError.parseFailure` if parsing fails
+    public func parse(_ gblnString: String) throws -> Any {
+        var gblnString = gblnString
+
+        return try gblnString.withUTF8 { utf8 in
+            try parse(UnsafeRawBufferPointer(utf8))
+        }
+    }
+
+    /// Parse GBLN from UTF-8 encoded `Data`.
+    ///
+    /// - Parameter data: UTF-8 encoded GBLN bytes
+    /// - Returns: Swift value (Dictionary, Array, or primitive)
+    /// - Throws: `GblnError.parseFailure` if parsing fails
+    public func parse(_ data: Data) throws -> Any {
+        return try data.withUnsafeBytes { buffer in
+            try parse(buffer)
+        }
+    }
+
+    /// Parse GBLN from a UTF-8 encoded byte array.
+    ///
+    /// - Parameter bytes: UTF-8 encoded GBLN bytes
+    /// - Returns: Swift value (Dictionary, Array, or primitive)
+    /// - Throws: `GblnError.parseFailure` if parsing fails
+    public func parse(_ bytes: [UInt8]) throws -> Any {
+        return try bytes.withUnsafeBytes { buffer in
+            try parse(buffer)
+        }
+    }
+
+    /// Release the last parsed document while keeping buffers for reuse.
+    ///
+    /// Parsing resets the parser automatically; call this only to drop a
+    /// large document early between messages.
+    public func reset() {
+        FFI.parserReset(ptr)
+    }
+}
@@ -0,0 +1,127 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+import CGBLN
+import Foundation
+
+/// Incremental push parser for chunked input.
+///
+/// Feed input in arbitrary chunks as it arrives from a pipe, socket or
+/// decompression stream. Events are delivered to the handler as soon as
+/// they are complete; tokens split across chunks are buffered internally,
+/// so the whole payload never has to be held in memory.
+///
+/// A push parser is not thread-safe. Use one instance per stream.
+///
+/// # Examples
+///
+/// ```swift
+/// var sum = 0
+/// let parser = try GblnPushParser { event in
+///     if case .scalar(let value as Int, .u32) = event {
+///         sum += value
+///     }
+/// }
+///
+/// while let chunk = try stream.read(upToCount: 64 * 1024) {
+///     try parser.feed(chunk)
+/// }
+/// try parser.finish()
+/// ```
+public final class GblnPushParser {
+    private var ptr: OpaquePointer!
+    private let handler: (GblnStreamEvent) throws -> Void
+    private var handlerError: Error?
+
+    /// Create push parser.
+    ///
+    /// - Parameter handler: Called for every event, in document order.
+    ///   Throwing stops parsing; the error is rethrown from `feed` or `finish`.
+    /// - Throws: `GblnError.parseError` if the parser cannot be created
+    public init(handler: @escaping (GblnStreamEvent) throws -> Void) throws {
+        self.handler = handler
+        self.ptr = try FFI.pushNew(
+            callback: pushEventCallback,
+            userData: Unmanaged.passUnretained(self).toOpaque()
+        )
+    }
+
+    /// Free the push parser and its buffered input.
+    deinit {
+        if let ptr = ptr {
+            FFI.pushFree(ptr)
+        }
+    }
+
+    /// Feed the next chunk of input.
+    ///
+    /// - Parameter buffer: Next chunk of UTF-8 encoded GBLN bytes
+    /// - Throws: `GblnError.parseFailure` if the input is invalid, or the handler's error
+    public func feed(_ buffer: UnsafeRawBufferPointer) throws {
+        let result = try FFI.pushFeed(ptr, bytes: buffer)
+        try rethrowHandlerError(result)
+    }
+
+    /// Feed the next chunk of input.
+    ///
+    /// - Parameter data: Next chunk of UTF-8 encoded GBLN bytes
+    /// - Throws: `GblnError.parseFailure` if the input is invalid, or the handler's error
+    public func feed(_ data: Data) throws {
+        try data.withUnsafeBytes { buffer in
+            try feed(buffer)
+        }
+    }
+
+    /// Feed the next chunk of input.
+    ///
+    /// - Parameter bytes: Next chunk of UTF-8 encoded GBLN bytes
+    /// - Throws: `GblnError.parseFailure` if the input is invalid, or the handler's error
+    public func feed(_ bytes: [UInt8]) throws {
+        try bytes.withUnsafeBytes { buffer in
+            try feed(buffer)
+        }
+    }
+
+    /// Signal end of input.
+    ///
+    /// - Throws: `GblnError.parseFailure` if the input ended mid-document, or the handler's error
+    public func finish() throws {
+        let result = try FFI.pushFinish(ptr)
+        try rethrowHandlerError(result)
+    }
+
+    /// Deliver a C event to the handler.
+    ///
+    /// - Parameter event: C event (valid only for the duration of this call)
+    /// - Returns: `Ok` to continue, `ErrorCallbackAborted` to stop parsing
+    fileprivate func dispatch(_ event: CGBLN.GblnEvent) -> GblnErrorCode {
+        do {
+            try handler(GblnStreamEvent(event))
+            return Ok
+        } catch {
+            handlerError = error
+            return ErrorCallbackAborted
+        }
+    }
+
+    /// Rethrow the handler's error if it stopped parsing.
+    private func rethrowHandlerError(_ result: GblnErrorCode) throws {
+        guard result == ErrorCallbackAborted else {
+            return
+        }
+
+        let error = handlerError ?? GblnError.parseError("Parsing aborted by event handler")
+        handlerError = nil
+        throw error
+    }
+}
+
+/// C callback that forwards events to the owning `GblnPushParser`.
+private let pushEventCallback: GblnEventCallback = { event, userData in
+    guard let event = event, let userData = userData else {
+        return ErrorNullPointer
+    }
+
+    let parser = Unmanaged<GblnPushParser>.fromOpaque(userData).takeUnretainedValue()
+    return parser.dispatch(event.pointee)
+}
@@ -0,0 +1,148 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+import Foundation
+
+/// Pull-based GBLN event reader.
+///
+/// Yields `GblnStreamEvent`s one at a time without building a value tree,
+/// so huge arrays can be scanned and aggregated in constant memory. When
+/// reading from a file, input is consumed in fixed-size blocks.
+///
+/// `GblnReader` is both an `IteratorProtocol` and a `Sequence`. Iteration
+/// stops at the end of input or at the first error, which is then
+/// available through `error`. Use `nextEvent()` to have errors thrown instead.
+///
+/// # Examples
+///
+/// ```swift
+/// // Sum a u32 field across millions of records
+/// let reader = try GblnReader(contentsOfFile: "records.gbln")
+/// var total = 0
+/// var inAmount = false
+///
+/// for event in reader {
+///     switch event {
+///     case .key(let key):
+///         inAmount = key == "amount"
+///     case .scalar(let value as Int, .u32) where inAmount:
+///         total += value
+///     default:
+///         break
+///     }
+/// }
+///
+/// if let error = reader.error {
+///     throw error
+/// }
+/// ```
+public final class GblnReader: IteratorProtocol, Sequence {
+    private let ptr: OpaquePointer
+    private let input: UnsafeMutableRawBufferPointer?
+    private let fileHandle: FileHandle?
+
+    /// Error that ended iteration through `next()`, if any.
+    public private(set) var error: Error?
+
+    /// Create reader over a raw UTF-8 byte buffer.
+    ///
+    /// The bytes are copied once into storage owned by the reader.
+    ///
+    /// - Parameter buffer: UTF-8 encoded GBLN bytes
+    /// - Throws: `GblnError.parseError` if the reader cannot be created
+    public convenience init(_ buffer: UnsafeRawBufferPointer) throws {
+        try self.init(ownedInput: FFI.copyInput(buffer))
+    }
+
+    /// Create reader over UTF-8 encoded `Data`.
+    ///
+    /// - Parameter data: UTF-8 encoded GBLN bytes
+    /// - Throws: `GblnError.parseError` if the reader cannot be created
+    public convenience init(_ data: Data) throws {
+        try self.init(ownedInput: data.withUnsafeBytes(FFI.copyInput))
+    }
+
+    /// Create reader over a GBLN string.
+    ///
+    /// - Parameter gblnString: GBLN-formatted string
+    /// - Throws: `GblnError.parseError` if the reader cannot be created
+    public convenience init(_ gblnString: String) throws {
+        var gblnString = gblnString
+
+        let input = gblnString.withUTF8 { utf8 in
+            FFI.copyInput(UnsafeRawBufferPointer(utf8))
+        }
+
+        try self.init(ownedInput: input)
+    }
+
+    /// Create reader that streams an uncompressed GBLN file.
+    ///
+    /// The file is only read front to back, so FIFOs and `/dev/stdin` work
+    /// as well as regular files. XZ-compressed input, such as files written
+    /// with `GblnConfig.io`, cannot be streamed: the first `nextEvent()`
+    /// throws `GblnError.ioError`. Read such files with `readIo(from:)`.
+    ///
+    /// - Parameter path: File path (absolute or relative)
+    /// - Throws: `GblnError.ioError` if the file cannot be opened
+    public init(contentsOfFile path: String) throws {
+        guard let fileHandle = FileHandle(forReadingAtPath: path) else {
+            throw GblnError.ioError("Failed to open file '\(path)'")
+        }
+
+        self.ptr = try FFI.readerNew(fileDescriptor: fileHandle.fileDescriptor)
+        self.input = nil
+        self.fileHandle = fileHandle
+    }
+
+    /// Create reader over input storage owned by this instance.
+    ///
+    /// - Parameter input: Input bytes (ownership is taken, freed on error)
+    /// - Throws: `GblnError.parseError` if the reader cannot be created
+    private init(ownedInput input: UnsafeMutableRawBufferPointer) throws {
+        do {
+            self.ptr = try FFI.readerNew(bytes: UnsafeRawBufferPointer(input))
+        } catch {
+            input.deallocate()
+            throw error
+        }
+
+        self.input = input
+        self.fileHandle = nil
+    }
+
+    /// Free the reader and its input.
+    deinit {
+        FFI.readerFree(ptr)
+        input?.deallocate()
+        try? fileHandle?.close()
+    }
+
+    /// Read the next event.
+    ///
+    /// - Returns: Next event, or `nil` at end of input
+    /// - Throws: `GblnError.parseFailure` if the input is invalid, or `GblnError.ioError` if reading fails
+    public func nextEvent() throws -> GblnStreamEvent? {
+        guard let event = try FFI.readerNext(ptr, input: input.map(UnsafeRawBufferPointer.init)) else {
+            return nil
+        }
+
+        return try GblnStreamEvent(event)
+    }
+
+    /// Read the next event, recording any error in `error`.
+    ///
+    /// - Returns: Next event, or `nil` at end of input or after an error
+    public func next() -> GblnStreamEvent? {
+        guard error == nil else {
+            return nil
+        }
+
+        do {
+            return try nextEvent()
+        } catch {
+            self.error = error
+            return nil
+        }
+    }
+}
@@ -0,0 +1,210 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+import CGBLN
+import Foundation
+
+/// Precompiled schema that decodes GBLN documents straight into memory.
+///
+/// For fixed-shape messages, a schema maps each field path to a native
+/// field of a caller-owned struct. Decoding skips the generic value tree
+/// and all per-field lookups, writing values directly into place.
+///
+/// A compiled schema is immutable and may be shared between threads.
+///
+/// # Native Layouts
+///
+/// - `.i8` ... `.u64`: `Int8` ... `UInt64`
+/// - `.f32` / `.f64`: `Float` / `Double`
+/// - `.bool`: `Bool`
+/// - `.string`: inline buffer of `capacity` bytes, written null-terminated
+///
+/// # Examples
+///
+/// ```swift
+/// struct Reading {
+///     var sensor: UInt32 = 0
+///     var value: Double = 0
+///     var valid: Bool = false
+/// }
+///
+/// let schema = try GblnSchema(fields: [
+///     .init(path: "reading.sensor", type: .u32, offset: MemoryLayout<Reading>.offset(of: \.sensor)!),
+///     .init(path: "reading.value", type: .f64, offset: MemoryLayout<Reading>.offset(of: \.value)!),
+///     .init(path: "reading.valid", type: .bool, offset: MemoryLayout<Reading>.offset(of: \.valid)!)
+/// ])
+///
+/// var reading = Reading()
+/// try schema.decode(message, into: &reading)
+///
+/// // Before Swift 6, decode into the struct's raw memory instead
+/// try withUnsafeMutableBytes(of: &reading) { target in
+///     try schema.decode(message, to: target.baseAddress!)
+/// }
+/// ```
+public final class GblnSchema {
+    /// Description of one decoded field.
+    public struct Field {
+        /// Dot-separated path from the document root, e.g. `reading.sensor.id`.
+        public var path: String
+
+        /// Expected type; must match the document's type hint exactly.
+        public var type: GblnType
+
+        /// Byte offset of the native field in the target memory.
+        public var offset: Int
+
+        /// Inline buffer size in bytes for `.string` fields, including the null terminator.
+        public var capacity: Int
+
+        /// Whether a missing field is an error. Optional fields are left untouched.
+        public var required: Bool
+
+        /// Create field description.
+        ///
+        /// - Parameters:
+        ///   - path: Dot-separated path from the document root
+        ///   - type: Expected scalar type
+        ///   - offset: Byte offset of the native field
+        ///   - capacity: Inline buffer size for `.string` fields (default: 0)
+        ///   - required: Whether a missing field is an error (default: true)
+        public init(path: String, type: GblnType, offset: Int, capacity: Int = 0, required: Bool = true) {
+            self.path = path
+            self.type = type
+            self.offset = offset
+            self.capacity = capacity
+            self.required = required
+        }
+
+        /// Size in bytes of the native field.
+        var size: Int? {
+            switch type {
+            case .i8, .u8, .bool: return 1
+            case .i16, .u16: return 2
+            case .i32, .u32, .f32: return 4
+            case .i64, .u64, .f64: return 8
+            case .string: return capacity > 0 ? capacity : nil
+            case .null, .object, .array: return nil
+            }
+        }
+    }
+
+    private let ptr: OpaquePointer
+
+    /// Bytes of target memory covered by the schema's fields.
+    public let extent: Int
+
+    /// Compile a schema.
+    ///
+    /// - Parameter fields: Field descriptions
+    /// - Throws: `GblnError.validationError` if a field has a non-scalar type,
+    ///   a `.string` field has no capacity, an offset is negative, or two fields share a path
+    public init(fields: [Field]) throws {
+        var extent = 0
+
+        for field in fields {
+            guard let size = field.size, field.offset >= 0 else {
+                throw GblnError.validationError("Invalid schema field '\(field.path)'")
+            }
+            extent = max(extent, field.offset + size)
+        }
+
+        // Path strings only need to outlive the compile call
+        let paths = fields.map { strdup($0.path) }
+        defer { paths.forEach { free($0) } }
+
+        let cFields = zip(fields, paths).map { field, path in
+            GblnSchemaField(
+                path: UnsafePointer(path),
+                value_type: field.type.cValueType,
+                offset: UInt(field.offset),
+                capacity: UInt(field.capacity),
+                required: field.required
+            )
+        }
+
+        self.ptr = try FFI.schemaCompile(cFields)
+        self.extent = extent
+    }
+
+    /// Free the compiled schema.
+    deinit {
+        FFI.schemaFree(ptr)
+    }
+
+    /// Decode GBLN bytes into raw memory.
+    ///
+    /// - Parameters:
+    ///   - buffer: UTF-8 encoded GBLN bytes
+    ///   - out: Writable memory of at least `extent` bytes
+    /// - Throws: `GblnError.parseFailure` if the input is invalid or does not match the schema;
+    ///   on failure the target memory is unspecified
+    public func decode(_ buffer: UnsafeRawBufferPointer, to out: UnsafeMutableRawPointer) throws {
+        try FFI.decodeInto(ptr, bytes: buffer, out: out)
+    }
+
+    /// Decode UTF-8 encoded GBLN `Data` into raw memory.
+    ///
+    /// - Parameters:
+    ///   - data: UTF-8 encoded GBLN bytes
+    ///   - out: Writable memory of at least `extent` bytes
+    /// - Throws: `GblnError.parseFailure` if the input is invalid or does not match the schema
+    public func decode(_ data: Data, to out: UnsafeMutableRawPointer) throws {
+        try data.withUnsafeBytes { buffer in
+            try decode(buffer, to: out)
+        }
+    }
+
+    #if compiler(>=6.0)
+    /// Decode UTF-8 encoded GBLN `Data` into a value of a bitwise-copyable type.
+    ///
+    /// Only available with Swift 6 compilers, where `BitwiseCopyable` rules
+    /// out targets with references, strings or arrays at compile time.
+    /// With older compilers, decode into raw memory with `decode(_:to:)`.
+    ///
+    /// - Parameters:
+    ///   - data: UTF-8 encoded GBLN bytes
+    ///   - value: Target value whose memory layout the schema's offsets describe
+    /// - Throws: `GblnError.validationError` if the schema does not fit in `T`,
+    ///   or `GblnError.parseFailure` if the input is invalid or does not match the schema
+    public func decode<T: BitwiseCopyable>(_ data: Data, into value: inout T) throws {
+        guard extent <= MemoryLayout<T>.size else {
+            throw GblnError.validationError("Schema does not fit in \(T.self)")
+        }
+
+        try withUnsafeMutableBytes(of: &value) { target in
+            guard let out = target.baseAddress else {
+                throw GblnError.validationError("Cannot decode into zero-sized \(T.self)")
+            }
+            try decode(data, to: out)
+        }
+    }
+    #endif
+}
+
+// MARK: - Internal C FFI Conversion
+
+internal extension GblnType {
+    /// Corresponding C value type.
+    ///
+    /// `Bool` and `Array` are qualified to avoid the standard library types.
+    var cValueType: GblnValueType {
+        switch self {
+        case .i8: return I8
+        case .i16: return I16
+        case .i32: return I32
+        case .i64: return I64
+        case .u8: return U8
+        case .u16: return U16
+        case .u32: return U32
+        case .u64: return U64
+        case .f32: return F32
+        case .f64: return F64
+        case .string: return Str
+        case .bool: return CGBLN.Bool
+        case .null: return Null
+        case .object: return Object
+        case .array: return CGBLN.Array
+        }
+    }
+}
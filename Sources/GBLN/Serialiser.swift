@@ -40,10 +40,11 @@ import Foundation
 /// - Parameters:
 ///   - value: Swift value to serialise
 ///   - mini: Use MINI format (default: true)
+///   - keyTable: Shared table to intern object keys in while building (default: none)
 /// - Returns: GBLN string (compact format)
 /// - Throws: `GblnError.serialiseError` if conversion fails
-public func toString(_ value: Any, mini: Bool = true) throws -> String {
-    let gblnValue = try swiftToGbln(value)
+public func toString(_ value: Any, mini: Bool = true, keyTable: GblnKeyTable? = nil) throws -> String {
+    let gblnValue = try swiftToGbln(value, keyTable: keyTable)
 
     if mini {
         return try FFI.toString(gblnValue.pointer)
@@ -52,6 +53,42 @@ public func toString(_ value: Any, mini: Bool = true) throws -> String {
     }
 }
 
+/// Serialise Swift value to one line of a GBLN record stream.
+///
+/// Produces MINI GBLN followed by `"\n"`, ready to be appended to a stream
+/// read back with `parseRecords(_:threads:)`. Record streams are framed by
+/// raw line feeds, so values whose strings contain `"\n"` are rejected
+/// rather than written as a record that would be split in two.
+///
+/// # Examples
+///
+/// ```swift
+/// let line = try toRecordLine(["seq": 1, "event": "login"])
+/// // → "{event<s64>(login)seq<i8>(1)}\n"
+///
+/// // Records with the same keys share key storage through one table
+/// let keys = try GblnKeyTable()
+/// for event in events {
+///     stream.write(try toRecordLine(event, keyTable: keys))
+/// }
+/// ```
+///
+/// - Parameters:
+///   - value: Swift value to serialise
+///   - keyTable: Shared table to intern object keys in while building (default: none)
+/// - Returns: MINI GBLN record terminated by a line feed
+/// - Throws: `GblnError.serialiseError` if conversion fails or a string value contains a line feed
+public func toRecordLine(_ value: Any, keyTable: GblnKeyTable? = nil) throws -> String {
+    let record = try toString(value, mini: true, keyTable: keyTable)
+
+    // MINI output has no whitespace outside strings, so any LF is in a value
+    guard !record.utf8.contains(0x0A) else {
+        throw GblnError.serialiseError("Record contains a line feed in a string value; record streams are line-delimited")
+    }
+
+    return record + "\n"
+}
+
 /// Serialise Swift value to pretty-printed GBLN string.
 ///
 /// Converts a Swift value to formatted GBLN with newlines and indentation.
@@ -7,7 +7,8 @@ import Foundation
 /// Managed wrapper for GblnValue with automatic memory cleanup.
 ///
 /// This class wraps an opaque pointer to a C GblnValue and ensures
-/// it's properly freed when the Swift object is deallocated.
+/// it's properly freed when the Swift object is deallocated. Values from
+/// `FFI.parse` are arena-backed, so the free is a single deallocation.
 internal class ManagedValue {
     private let ptr: OpaquePointer
 
@@ -45,10 +46,12 @@ internal class ManagedValue {
 /// - `[String: Any]` → GBLN Object
 /// - `[Any]` → GBLN Array
 ///
-/// - Parameter value: Swift value to convert
+/// - Parameters:
+///   - value: Swift value to convert
+///   - keyTable: Table to intern object keys in, or `nil` to copy them
 /// - Returns: Managed GBLN value
 /// - Throws: `GblnError.serialiseError` if conversion fails
-internal func swiftToGbln(_ value: Any?) throws -> ManagedValue {
+internal func swiftToGbln(_ value: Any?, keyTable: GblnKeyTable? = nil) throws -> ManagedValue {
     // Handle nil
     if value == nil {
         let ptr = gbln_value_new_null()
@@ -87,13 +90,13 @@ internal func swiftToGbln(_ value: Any?) throws -> ManagedValue {
 
     // Handle Dictionary → Object
     if let dict = value as? [String: Any] {
-        let ptr = try convertDictToObject(dict)
+        let ptr = try convertDictToObject(dict, keyTable: keyTable)
         return ManagedValue(ptr)
     }
 
     // Handle Array
     if let array = value as? [Any] {
-        let ptr = try convertArrayToGbln(array)
+        let ptr = try convertArrayToGbln(array, keyTable: keyTable)
         return ManagedValue(ptr)
     }
 
@@ -125,7 +128,8 @@ private func autoSelectIntegerType(_ value: Int) -> OpaquePointer {
 
 /// Auto-select string type based on character count.
 ///
-/// Selects GBLN string type based on UTF-8 character count:
+/// Selects GBLN string type based on Unicode code point count, which is
+/// what `sN` hints bound:
 /// - ≤64 chars → s64
 /// - ≤256 chars → s256
 /// - ≤1024 chars → s1024
@@ -135,7 +139,12 @@ private func autoSelectIntegerType(_ value: Int) -> OpaquePointer {
 /// - Returns: Opaque pointer to GBLN string value
 /// - Throws: `GblnError.serialiseError` if string too long
 private func autoSelectStringType(_ value: String) throws -> OpaquePointer {
-    let charCount = value.count  // UTF-8 character count
+    var value = value
+
+    // A string never has more code points than UTF-8 bytes,
+    // so short strings need no counting pass
+    let byteCount = value.utf8.count
+    let charCount = byteCount <= 64 ? byteCount : value.unicodeScalars.count
 
     let maxLen: UInt
     if charCount <= 64 {
@@ -148,8 +157,8 @@ private func autoSelectStringType(_ value: String) throws -> OpaquePointer {
         throw GblnError.serialiseError("String too long: \(charCount) characters (max 1024)")
     }
 
-    guard let ptr = value.withCString({ cStr in
-        gbln_value_new_str(cStr, maxLen)
+    guard let ptr = value.withUTF8({ utf8 in
+        gbln_value_new_str_n(utf8.baseAddress, UInt(utf8.count), maxLen)
     }) else {
         throw GblnError.serialiseError("Failed to create string value")
     }
@@ -159,21 +168,37 @@ private func autoSelectStringType(_ value: String) throws -> OpaquePointer {
 
 /// Convert Swift Dictionary to GBLN Object.
 ///
-/// - Parameter dict: Swift dictionary with string keys
+/// The object is created pre-sized for `dict.count` fields so that wide
+/// dictionaries never grow the field storage or hash index mid-build.
+/// With a key table, keys are interned in it instead of copied.
+///
+/// - Parameters:
+///   - dict: Swift dictionary with string keys
+///   - keyTable: Table to intern keys in, or `nil` to copy them
 /// - Returns: Opaque pointer to GBLN object value
 /// - Throws: `GblnError.serialiseError` if conversion fails
-private func convertDictToObject(_ dict: [String: Any]) throws -> OpaquePointer {
-    guard let objPtr = gbln_value_new_object() else {
+private func convertDictToObject(_ dict: [String: Any], keyTable: GblnKeyTable?) throws -> OpaquePointer {
+    let created: OpaquePointer?
+    if let keyTable = keyTable {
+        created = gbln_value_new_object_in(keyTable.ptr, UInt(dict.count))
+    } else {
+        created = gbln_value_new_object_with_capacity(UInt(dict.count))
+    }
+
+    guard let objPtr = created else {
         throw GblnError.serialiseError("Failed to create object")
     }
 
     for (key, val) in dict {
-        let gblnVal = try swiftToGbln(val)
+        let gblnVal = try swiftToGbln(val, keyTable: keyTable)
 
         let result = key.withCString { keyCStr in
             gbln_object_insert(objPtr, keyCStr, gblnVal.pointer)
         }
 
+        // Builder objects are never arena-backed; a mismatch means a parsed tree got here
+        assert(result != ErrorTypeMismatch, "Attempted to insert into a read-only parsed object")
+
         if result != Ok {
             // On error, free both the object and the value we just created
             gbln_value_free(objPtr)
@@ -186,19 +211,23 @@ private func convertDictToObject(_ dict: [String: Any]) throws -> OpaquePointer
 
 /// Convert Swift Array to GBLN Array.
 ///
-/// - Parameter array: Swift array
+/// - Parameters:
+///   - array: Swift array
+///   - keyTable: Table to intern object keys in, or `nil` to copy them
 /// - Returns: Opaque pointer to GBLN array value
 /// - Throws: `GblnError.serialiseError` if conversion fails
-private func convertArrayToGbln(_ array: [Any]) throws -> OpaquePointer {
+private func convertArrayToGbln(_ array: [Any], keyTable: GblnKeyTable?) throws -> OpaquePointer {
     guard let arrPtr = gbln_value_new_array() else {
         throw GblnError.serialiseError("Failed to create array")
     }
 
     for item in array {
-        let gblnItem = try swiftToGbln(item)
+        let gblnItem = try swiftToGbln(item, keyTable: keyTable)
 
         let result = gbln_array_push(arrPtr, gblnItem.pointer)
 
+        assert(result != ErrorTypeMismatch, "Attempted to push onto a read-only parsed array")
+
         if result != Ok {
             // On error, free both the array and the item we just created
             gbln_value_free(arrPtr)
@@ -216,16 +245,18 @@ private func convertArrayToGbln(_ array: [Any]) throws -> OpaquePointer {
 /// Returns the appropriate Swift type based on GBLN type:
 /// - GBLN Null → `nil`
 /// - GBLN Bool → `Bool`
-/// - GBLN integers → `Int`
+/// - GBLN integers → `Int` (u64 values above `Int.max` throw)
 /// - GBLN floats → `Double`
 /// - GBLN Str → `String`
 /// - GBLN Object → `[String: Any]`
 /// - GBLN Array → `[Any]`
 ///
-/// - Parameter ptr: Opaque pointer to GBLN value
+/// - Parameters:
+///   - ptr: Opaque pointer to GBLN value
+///   - keys: Key strings of the table the value's keys are interned in, if any
 /// - Returns: Swift value, or `nil` for GBLN Null
 /// - Throws: `GblnError.parseError` if conversion fails
-internal func gblnToSwift(_ ptr: OpaquePointer) throws -> Any? {
+internal func gblnToSwift(_ ptr: OpaquePointer, keys: GblnKeyStrings? = nil) throws -> Any? {
     let valueType = FFI.valueType(ptr)
 
     switch valueType {
@@ -257,7 +288,7 @@ internal func gblnToSwift(_ ptr: OpaquePointer) throws -> Any? {
         return Int(try FFI.asU32(ptr))
 
     case U64:
-        return Int(try FFI.asU64(ptr))
+        return try intFromU64(try FFI.asU64(ptr))
 
     case F32:
         return Double(try FFI.asF32(ptr))
@@ -269,10 +300,10 @@ internal func gblnToSwift(_ ptr: OpaquePointer) throws -> Any? {
         return try FFI.asString(ptr)
 
     case Object:
-        return try convertObjectToDict(ptr)
+        return try convertObjectToDict(ptr, keys: keys)
 
     case Array:
-        return try convertArrayToSwift(ptr)
+        return try convertArrayToSwift(ptr, keys: keys)
 
     default:
         throw GblnError.parseError("Unknown GBLN value type: \(valueType.rawValue)")
@@ -281,20 +312,27 @@ internal func gblnToSwift(_ ptr: OpaquePointer) throws -> Any? {
 
 /// Convert GBLN Object to Swift Dictionary.
 ///
-/// - Parameter ptr: Opaque pointer to GBLN object value
+/// With the key strings of a key table, each key is looked up by its
+/// interned address, so equal keys across dictionaries share one `String`.
+///
+/// - Parameters:
+///   - ptr: Opaque pointer to GBLN object value
+///   - keys: Key strings of the table the keys are interned in, if any
 /// - Returns: Swift dictionary
 /// - Throws: `GblnError.parseError` if conversion fails
-private func convertObjectToDict(_ ptr: OpaquePointer) throws -> [String: Any] {
-    var dict: [String: Any] = [:]
+private func convertObjectToDict(_ ptr: OpaquePointer, keys: GblnKeyStrings?) throws -> [String: Any] {
+    let count = FFI.objectLen(ptr)
 
-    let keys = try FFI.objectKeys(ptr)
+    var dict: [String: Any] = [:]
+    dict.reserveCapacity(count)
 
-    for key in keys {
-        guard let fieldPtr = FFI.objectGet(ptr, key: key) else {
+    for i in 0..<count {
+        guard let entry = FFI.objectEntry(ptr, at: i) else {
             continue
         }
 
-        dict[key] = try gblnToSwift(fieldPtr)
+        let key = keys?.string(for: entry.key) ?? String(decoding: entry.key, as: UTF8.self)
+        dict[key] = try gblnToSwift(entry.value, keys: keys)
     }
 
     return dict
@@ -302,10 +340,16 @@ private func convertObjectToDict(_ ptr: OpaquePointer) throws -> [String: Any] {
 
 /// Convert GBLN Array to Swift Array.
 ///
-/// - Parameter ptr: Opaque pointer to GBLN array value
+/// - Parameters:
+///   - ptr: Opaque pointer to GBLN array value
+///   - keys: Key strings of the table object keys are interned in, if any
 /// - Returns: Swift array
 /// - Throws: `GblnError.parseError` if conversion fails
-private func convertArrayToSwift(_ ptr: OpaquePointer) throws -> [Any?] {
+private func convertArrayToSwift(_ ptr: OpaquePointer, keys: GblnKeyStrings?) throws -> [Any?] {
+    if let packed = try convertPackedArrayToSwift(ptr) {
+        return packed
+    }
+
     var array: [Any?] = []
 
     let count = FFI.arrayLen(ptr)
@@ -315,8 +359,50 @@ private func convertArrayToSwift(_ ptr: OpaquePointer) throws -> [Any?] {
             continue
         }
 
-        array.append(try gblnToSwift(itemPtr))
+        array.append(try gblnToSwift(itemPtr, keys: keys))
     }
 
     return array
 }
+
+/// Convert a packed scalar array straight from its native buffer.
+///
+/// Reads all elements through one slice call instead of two or three FFI
+/// calls per element.
+///
+/// - Parameter ptr: Pointer to array value
+/// - Returns: Swift array, or nil if the array is not packed
+/// - Throws: `GblnError.parseError` if a u64 element does not fit in `Int`
+private func convertPackedArrayToSwift(_ ptr: OpaquePointer) throws -> [Any?]? {
+    func convert<T>(_ accessor: FFI.ArraySliceAccessor<T>, _ transform: (T) throws -> Any) rethrows -> [Any?]? {
+        return try FFI.arraySlice(ptr, accessor).map { elements in try elements.map(transform) }
+    }
+
+    switch FFI.arrayElementType(ptr) {
+    case I8: return convert(gbln_array_as_i8_slice) { Int($0) }
+    case I16: return convert(gbln_array_as_i16_slice) { Int($0) }
+    case I32: return convert(gbln_array_as_i32_slice) { Int($0) }
+    case I64: return convert(gbln_array_as_i64_slice) { Int($0) }
+    case U8: return convert(gbln_array_as_u8_slice) { Int($0) }
+    case U16: return convert(gbln_array_as_u16_slice) { Int($0) }
+    case U32: return convert(gbln_array_as_u32_slice) { Int($0) }
+    case U64: return try convert(gbln_array_as_u64_slice, intFromU64)
+    case F32: return convert(gbln_array_as_f32_slice) { Double($0) }
+    case F64: return convert(gbln_array_as_f64_slice) { $0 }
+    case CGBLN.Bool: return convert(gbln_array_as_bool_slice) { $0 }
+    default: return nil
+    }
+}
+
+/// Convert a u64 value to `Int`.
+///
+/// - Parameter value: Decoded u64 value
+/// - Returns: Same value as `Int`
+/// - Throws: `GblnError.parseError` if the value is above `Int.max`
+private func intFromU64(_ value: UInt64) throws -> Int {
+    guard let int = Int(exactly: value) else {
+        throw GblnError.parseError("u64 value \(value) does not fit in Int")
+    }
+
+    return int
+}
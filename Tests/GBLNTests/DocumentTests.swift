@@ -0,0 +1,140 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+import XCTest
+@testable import GBLN
+
+/// Test suite for on-demand `GblnDocument` access.
+///
+/// Tests cover:
+/// - Path lookup through objects and arrays
+/// - Opening memory-mapped files
+/// - Bulk copies of typed arrays
+/// - Missing paths
+/// - Deferred validation of values that are read
+/// - Syntax errors at open time
+final class DocumentTests: XCTestCase {
+
+    // MARK: - Path Lookup
+
+    func testValueAtNestedPath() throws {
+        let bundle = Bundle.module
+        guard let path = bundle.path(forResource: "nested", ofType: "gbln", inDirectory: "Fixtures/valid") else {
+            XCTFail("Test fixture not found")
+            return
+        }
+
+        let doc = try GblnDocument(Data(contentsOf: URL(fileURLWithPath: path)))
+
+        XCTAssertEqual(try doc.value(at: "response", "status") as? Int, 200)
+        XCTAssertEqual(try doc.value(at: "response", "data", "user", "id") as? Int, 12345)
+        XCTAssertEqual(try doc.value(at: "response", "data", "user", "name") as? String, "Alice Johnson")
+    }
+
+    func testValueAtSubtree() throws {
+        let doc = try GblnDocument("response{status<u16>(200)data{user{id<u32>(7)role<s16>(admin)}}}")
+
+        let user = try XCTUnwrap(doc.value(at: "response", "data", "user") as? [String: Any])
+        XCTAssertEqual(user["id"] as? Int, 7)
+        XCTAssertEqual(user["role"] as? String, "admin")
+    }
+
+    func testValueAtArrayIndex() throws {
+        let doc = try GblnDocument("users[{id<u32>(1)name<s32>(Alice)}{id<u32>(2)name<s32>(Bob)}]")
+
+        XCTAssertEqual(try doc.value(at: "users", "1", "name") as? String, "Bob")
+        XCTAssertNil(try doc.value(at: "users", "2", "name"))
+        XCTAssertNil(try doc.value(at: "users", "first"))
+    }
+
+    func testValueAtMissingPath() throws {
+        let doc = try GblnDocument("user{id<u32>(123)}")
+
+        XCTAssertNil(try doc.value(at: "user", "email"))
+        XCTAssertNil(try doc.value(at: "user", "id", "deeper"))
+    }
+
+    func testValueAtEmptyPath() throws {
+        let doc = try GblnDocument("<i32>(42)")
+        XCTAssertEqual(try doc.value(at: []) as? Int, 42)
+    }
+
+    // MARK: - Files
+
+    func testOpenFile() throws {
+        let bundle = Bundle.module
+        guard let path = bundle.path(forResource: "nested", ofType: "gbln", inDirectory: "Fixtures/valid") else {
+            XCTFail("Test fixture not found")
+            return
+        }
+
+        let doc = try GblnDocument(contentsOfFile: path)
+
+        XCTAssertEqual(try doc.value(at: "response", "data", "user", "name") as? String, "Alice Johnson")
+    }
+
+    func testOpenMissingFile() throws {
+        XCTAssertThrowsError(try GblnDocument(contentsOfFile: "/nonexistent/path/file.gbln")) { error in
+            guard case .ioError = error as? GblnError else {
+                XCTFail("Expected ioError, got \(error)")
+                return
+            }
+        }
+    }
+
+    // MARK: - Typed Arrays
+
+    func testInt64Array() throws {
+        let doc = try GblnDocument("m{ids<u32>[1 2 3]deltas<i8>[-1 0 1]}")
+
+        XCTAssertEqual(try doc.int64Array(at: "m", "ids"), [1, 2, 3])
+        XCTAssertEqual(try doc.int64Array(at: "m", "deltas"), [-1, 0, 1])
+        XCTAssertNil(try doc.int64Array(at: "m", "missing"))
+    }
+
+    func testDoubleArray() throws {
+        let samples = (0..<100_000).map { "\(Double($0) / 4)" }.joined(separator: " ")
+        let doc = try GblnDocument("samples<f64>[\(samples)]")
+
+        let values = try XCTUnwrap(doc.doubleArray(at: "samples"))
+
+        XCTAssertEqual(values.count, 100_000)
+        XCTAssertEqual(values[0], 0)
+        XCTAssertEqual(values[99_999], 24_999.75)
+    }
+
+    func testBoolArray() throws {
+        let doc = try GblnDocument("flags<b>[t f t]")
+
+        XCTAssertEqual(try doc.boolArray(at: "flags"), [true, false, true])
+    }
+
+    func testTypedArrayMismatch() throws {
+        let doc = try GblnDocument("d{big<u64>[18446744073709551615]tags<s16>[a b]}")
+
+        XCTAssertThrowsError(try doc.int64Array(at: "d", "big"))
+        XCTAssertThrowsError(try doc.doubleArray(at: "d", "tags"))
+        XCTAssertThrowsError(try doc.boolArray(at: "d", "tags"))
+    }
+
+    // MARK: - Validation
+
+    func testUntouchedInvalidValueIsNotReported() throws {
+        let doc = try GblnDocument("msg{ok<u8>(1)bad<i8>(999)}")
+        XCTAssertEqual(try doc.value(at: "msg", "ok") as? Int, 1)
+    }
+
+    func testTouchedInvalidValueThrows() throws {
+        let doc = try GblnDocument("msg{ok<u8>(1)bad<i8>(999)}")
+
+        XCTAssertThrowsError(try doc.value(at: "msg", "bad")) { error in
+            XCTAssertTrue(error is GblnError)
+        }
+    }
+
+    func testOpenInvalidSyntax() throws {
+        XCTAssertThrowsError(try GblnDocument("user{id<u32>(123)")) { error in
+            XCTAssertTrue(error is GblnError)
+        }
+    }
+}
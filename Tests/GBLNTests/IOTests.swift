@@ -94,6 +94,24 @@ final class IOTests: XCTestCase {
         XCTAssertEqual(dict["id"] as? Int, 123)
     }
 
+    // MARK: - Parallel Read
+
+    func testWriteReadParallel() throws {
+        let records: [Any] = (0..<5000).map { ["id": $0, "name": "user\($0)"] }
+        let path = tempDir.appendingPathComponent("test-parallel.io.gbln.xz").path
+
+        try writeIo(["records": records], to: path)
+        let loaded = try readIo(from: path, threads: 4)
+
+        let dict = try XCTUnwrap(loaded as? [String: Any])
+        let parsed = try XCTUnwrap(dict["records"] as? [Any?])
+        XCTAssertEqual(parsed.count, 5000)
+
+        let last = try XCTUnwrap(parsed[4999] as? [String: Any])
+        XCTAssertEqual(last["id"] as? Int, 4999)
+        XCTAssertEqual(last["name"] as? String, "user4999")
+    }
+
     // MARK: - UTF-8 Handling
 
     func testWriteReadUTF8() throws {
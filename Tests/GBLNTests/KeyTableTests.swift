@@ -0,0 +1,98 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+import XCTest
+@testable import GBLN
+
+/// Test suite for the shared `GblnKeyTable`.
+///
+/// Tests cover:
+/// - Interning repeated keys across documents
+/// - Sharing one table between parsers on several threads
+/// - Parsing unaffected by interning
+/// - Interning object keys while building values
+final class KeyTableTests: XCTestCase {
+
+    // MARK: - Interning
+
+    func testRepeatedKeysInternedOnce() throws {
+        let keys = try GblnKeyTable()
+        let parser = try GblnParser(keyTable: keys)
+
+        XCTAssertEqual(keys.count, 0)
+
+        for i in 0..<1000 {
+            _ = try parser.parse("user{id<u32>(\(i))name<s16>(u\(i))status<s8>(ok)}")
+        }
+
+        XCTAssertEqual(keys.count, 4)
+    }
+
+    func testParseResultUnchanged() throws {
+        let parser = try GblnParser(keyTable: GblnKeyTable())
+
+        let result = try parser.parse("user{id<u32>(7)tags<s16>[a b]}")
+
+        let dict = try XCTUnwrap(result as? [String: Any])
+        let user = try XCTUnwrap(dict["user"] as? [String: Any])
+        XCTAssertEqual(user["id"] as? Int, 7)
+        XCTAssertEqual((user["tags"] as? [Any?])?.count, 2)
+    }
+
+    func testTableOutlivesOwnReference() throws {
+        var keys: GblnKeyTable? = try GblnKeyTable()
+        let parser = try GblnParser(keyTable: XCTUnwrap(keys))
+        _ = try parser.parse("msg{seq<u32>(1)}")
+
+        // Releases the only Swift reference; the parser's binding must keep
+        // the C table, and the keys interned in it, alive
+        weak var released = keys
+        keys = nil
+        XCTAssertNil(released)
+
+        for seq in 2...100 {
+            let result = try parser.parse("msg{seq<u32>(\(seq))}")
+            let dict = try XCTUnwrap(result as? [String: Any])
+            let msg = try XCTUnwrap(dict["msg"] as? [String: Any])
+            XCTAssertEqual(msg["seq"] as? Int, seq)
+        }
+    }
+
+    // MARK: - Building
+
+    func testSerialiseWithKeyTable() throws {
+        let keys = try GblnKeyTable()
+        let record: [String: Any] = ["id": 7, "name": "Alice"]
+
+        let line = try toRecordLine(record, keyTable: keys)
+
+        XCTAssertEqual(keys.count, 2)
+        XCTAssertEqual(line, try toRecordLine(record))
+        XCTAssertEqual(try toString([record, record], keyTable: keys), try toString([record, record]))
+        XCTAssertEqual(keys.count, 2)
+    }
+
+    // MARK: - Sharing
+
+    func testSharedAcrossThreads() throws {
+        let keys = try GblnKeyTable()
+        let lock = NSLock()
+        var failures = 0
+
+        DispatchQueue.concurrentPerform(iterations: 8) { worker in
+            do {
+                let parser = try GblnParser(keyTable: keys)
+                for i in 0..<500 {
+                    _ = try parser.parse("rec{id<u32>(\(i))worker<u8>(\(worker))amount<f64>(1.5)}")
+                }
+            } catch {
+                lock.lock()
+                failures += 1
+                lock.unlock()
+            }
+        }
+
+        XCTAssertEqual(failures, 0)
+        XCTAssertEqual(keys.count, 4)
+    }
+}
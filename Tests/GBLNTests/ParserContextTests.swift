@@ -0,0 +1,106 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+import XCTest
+@testable import GBLN
+
+/// Test suite for the reusable `GblnParser` context.
+///
+/// Tests cover:
+/// - Parsing several documents with one parser
+/// - All input overloads (String, Data, bytes)
+/// - Recovery after a failed parse
+/// - Per-call error reporting across threads
+/// - Explicit reset
+final class ParserContextTests: XCTestCase {
+
+    // MARK: - Reuse
+
+    func testParseManyDocuments() throws {
+        let parser = try GblnParser()
+
+        for i in 0..<1000 {
+            let result = try parser.parse("msg{seq<u32>(\(i))body<s16>(ping)}")
+
+            let dict = try XCTUnwrap(result as? [String: Any])
+            let msg = try XCTUnwrap(dict["msg"] as? [String: Any])
+
+            XCTAssertEqual(msg["seq"] as? Int, i)
+            XCTAssertEqual(msg["body"] as? String, "ping")
+        }
+    }
+
+    func testResultsOutliveNextParse() throws {
+        let parser = try GblnParser()
+
+        let first = try parser.parse("<s16>(first)")
+        let second = try parser.parse("<s16>(second)")
+
+        XCTAssertEqual(first as? String, "first")
+        XCTAssertEqual(second as? String, "second")
+    }
+
+    // MARK: - Input Overloads
+
+    func testParseData() throws {
+        let parser = try GblnParser()
+        let result = try parser.parse(Data("<i32>(100000)".utf8))
+        XCTAssertEqual(result as? Int, 100000)
+    }
+
+    func testParseBytes() throws {
+        let parser = try GblnParser()
+        let result = try parser.parse(Array("<s16>(北京)".utf8))
+        XCTAssertEqual(result as? String, "北京")
+    }
+
+    func testParseNull() throws {
+        let parser = try GblnParser()
+        let result = try parser.parse("<n>()")
+        XCTAssertTrue(result is NSNull)
+    }
+
+    // MARK: - Errors and Reset
+
+    func testParseAfterError() throws {
+        let parser = try GblnParser()
+
+        XCTAssertThrowsError(try parser.parse("age<i8>(999)")) { error in
+            XCTAssertTrue(error is GblnError)
+        }
+
+        let result = try parser.parse("age<i8>(99)")
+        let dict = try XCTUnwrap(result as? [String: Any])
+        XCTAssertEqual(dict["age"] as? Int, 99)
+    }
+
+    func testConcurrentParserErrorsAreNotShared() throws {
+        let lock = NSLock()
+        var mismatches: [Int] = []
+
+        DispatchQueue.concurrentPerform(iterations: 64) { i in
+            do {
+                let parser = try GblnParser()
+                _ = try parser.parse("age<i8>(\(200 + i))")
+            } catch GblnError.parseFailure(let failure) where failure.message.contains("\(200 + i)") {
+                return
+            } catch {}
+
+            lock.lock()
+            mismatches.append(i)
+            lock.unlock()
+        }
+
+        XCTAssertEqual(mismatches, [])
+    }
+
+    func testReset() throws {
+        let parser = try GblnParser()
+
+        _ = try parser.parse("tags<s16>[rust python swift]")
+        parser.reset()
+
+        let result = try parser.parse("<b>(t)")
+        XCTAssertEqual(result as? Bool, true)
+    }
+}
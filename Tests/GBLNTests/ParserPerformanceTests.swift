@@ -0,0 +1,42 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+import XCTest
+@testable import GBLN
+
+/// Performance benchmarks for the parser's scalar decoders.
+///
+/// Skipped by default so that `swift test` stays fast. Run with:
+///
+/// ```
+/// GBLN_PERF=1 swift test -c release --filter ParserPerformanceTests
+/// ```
+final class ParserPerformanceTests: XCTestCase {
+
+    override func setUpWithError() throws {
+        try super.setUpWithError()
+        try XCTSkipUnless(ProcessInfo.processInfo.environment["GBLN_PERF"] != nil, "Set GBLN_PERF=1 to run benchmarks")
+    }
+
+    // MARK: - Integers
+
+    func testParseIdArrayPerformance() throws {
+        let ids = (0..<100_000).map { String(1_000_000_000_000 + $0 * 7_919) }.joined(separator: " ")
+        let data = Data("ids<u64>[\(ids)]".utf8)
+
+        measure {
+            _ = try? parse(data)
+        }
+    }
+
+    // MARK: - Floats
+
+    func testParseFloatArrayPerformance() throws {
+        let values = (0..<100_000).map { "\(Double($0) * 0.731)" }.joined(separator: " ")
+        let data = Data("samples<f64>[\(values)]".utf8)
+
+        measure {
+            _ = try? parse(data)
+        }
+    }
+}
@@ -14,6 +14,30 @@ import XCTest
 /// - Error cases
 final class ParserTests: XCTestCase {
 
+    /// Compare two converted GBLN values structurally.
+    private func valuesEqual(_ lhs: Any?, _ rhs: Any?) -> Bool {
+        switch (lhs, rhs) {
+        case (nil, nil):
+            return true
+        case let (l as [String: Any], r as [String: Any]):
+            return l.count == r.count && l.allSatisfy { key, value in
+                r[key].map { valuesEqual(value, $0) } ?? false
+            }
+        case let (l as [Any?], r as [Any?]):
+            return l.count == r.count && zip(l, r).allSatisfy { valuesEqual($0, $1) }
+        case let (l as Bool, r as Bool):
+            return l == r
+        case let (l as Int, r as Int):
+            return l == r
+        case let (l as Double, r as Double):
+            return l == r
+        case let (l as String, r as String):
+            return l == r
+        default:
+            return false
+        }
+    }
+
     // MARK: - Integer Parsing
 
     func testParseI8() throws {
@@ -51,6 +75,45 @@ final class ParserTests: XCTestCase {
         XCTAssertEqual(result as? Int, 4294967295)
     }
 
+    func testParseIntegerBounds() throws {
+        let bounds: [(hint: String, min: String, max: String, below: String, above: String)] = [
+            ("i8", "-128", "127", "-129", "128"),
+            ("i16", "-32768", "32767", "-32769", "32768"),
+            ("i32", "-2147483648", "2147483647", "-2147483649", "2147483648"),
+            ("i64", "-9223372036854775808", "9223372036854775807", "-9223372036854775809", "9223372036854775808"),
+            ("u8", "0", "255", "-1", "256"),
+            ("u16", "0", "65535", "-1", "65536"),
+            ("u32", "0", "4294967295", "-1", "4294967296"),
+            ("u64", "0", "18446744073709551615", "-1", "18446744073709551616")
+        ]
+
+        for bound in bounds {
+            XCTAssertEqual(try parse("<\(bound.hint)>(\(bound.min))") as? Int, Int(bound.min), bound.hint)
+            XCTAssertNoThrow(try validate("<\(bound.hint)>(\(bound.max))"), bound.hint)
+            if let max = Int(bound.max) {
+                XCTAssertEqual(try parse("<\(bound.hint)>(\(bound.max))") as? Int, max, bound.hint)
+            } else {
+                XCTAssertThrowsError(try parse("<\(bound.hint)>(\(bound.max))"), bound.hint) { error in
+                    guard case .parseError = error as? GblnError else {
+                        XCTFail("Expected parseError for \(bound.hint) max, got \(error)")
+                        return
+                    }
+                }
+            }
+            XCTAssertThrowsError(try parse("<\(bound.hint)>(\(bound.below))"), "\(bound.hint) below range")
+            XCTAssertThrowsError(try parse("<\(bound.hint)>(\(bound.above))"), "\(bound.hint) above range")
+        }
+    }
+
+    func testParseIntegerDigitCounts() throws {
+        // Cover every digit count around the 8- and 16-digit block boundaries
+        var literal = ""
+        for digit in 1...19 {
+            literal += String(digit % 10)
+            XCTAssertEqual(try parse("<i64>(\(literal))") as? Int, Int(literal), "\(digit) digits")
+        }
+    }
+
     // MARK: - Float Parsing
 
     func testParseF32() throws {
@@ -65,6 +128,32 @@ final class ParserTests: XCTestCase {
         XCTAssertEqual(value, 2.718281828459045, accuracy: 0.000000000000001)
     }
 
+    func testParseF64CorrectlyRounded() throws {
+        // Inputs that need more than a naive digit loop to round correctly
+        let literals = [
+            "0.1",
+            "0.3",
+            "9007199254740993",
+            "2.2250738585072011",
+            "1.7976931348623157",
+            "123456789012345678901234567890",
+            "0.000000000000000000000000000001"
+        ]
+
+        for literal in literals {
+            let result = try parse("<f64>(\(literal))")
+            XCTAssertEqual(result as? Double, Double(literal), "f64 literal \(literal)")
+        }
+    }
+
+    func testParseF32CorrectlyRounded() throws {
+        for literal in ["0.1", "3.4028235", "16777217", "1.17549435"] {
+            let result = try parse("<f32>(\(literal))")
+            let value = try XCTUnwrap(result as? Double)
+            XCTAssertEqual(Float(value), Float(literal), "f32 literal \(literal)")
+        }
+    }
+
     // MARK: - String Parsing
 
     func testParseString() throws {
@@ -87,6 +176,15 @@ final class ParserTests: XCTestCase {
         XCTAssertEqual(result as? String, "Hello👋")
     }
 
+    func testParseStringArrayMixedScripts() throws {
+        let result = try parse("cities<s16>[Berlin 北京 Zürich Москва]")
+
+        let dict = try XCTUnwrap(result as? [String: Any])
+        let cities = try XCTUnwrap(dict["cities"] as? [Any?])
+
+        XCTAssertEqual(cities.compactMap { $0 as? String }, ["Berlin", "北京", "Zürich", "Москва"])
+    }
+
     // MARK: - Boolean Parsing
 
     func testParseBoolTrue() throws {
@@ -168,6 +266,18 @@ final class ParserTests: XCTestCase {
         XCTAssertTrue(empty.isEmpty)
     }
 
+    func testParseWideObject() throws {
+        let fields = (0..<2000).map { "field\($0)<u16>(\($0))" }.joined()
+        let result = try parse("wide{\(fields)}")
+
+        let dict = try XCTUnwrap(result as? [String: Any])
+        let wide = try XCTUnwrap(dict["wide"] as? [String: Any])
+
+        XCTAssertEqual(wide.count, 2000)
+        XCTAssertEqual(wide["field0"] as? Int, 0)
+        XCTAssertEqual(wide["field1999"] as? Int, 1999)
+    }
+
     // MARK: - Array Parsing
 
     func testParseSimpleArray() throws {
@@ -209,6 +319,34 @@ final class ParserTests: XCTestCase {
         XCTAssertTrue(empty.isEmpty)
     }
 
+    func testParsePackedNumericArrays() throws {
+        let result = try parse("v{ids<u32>[1 2 4294967295]deltas<i8>[-128 0 127]samples<f64>[0.5 -1.25]gains<f32>[0.1]flags<b>[t f t]none<i32>[]}")
+
+        let dict = try XCTUnwrap(result as? [String: Any])
+        let v = try XCTUnwrap(dict["v"] as? [String: Any])
+
+        XCTAssertEqual((v["ids"] as? [Any?])?.compactMap { $0 as? Int }, [1, 2, 4_294_967_295])
+        XCTAssertEqual((v["deltas"] as? [Any?])?.compactMap { $0 as? Int }, [-128, 0, 127])
+        XCTAssertEqual((v["samples"] as? [Any?])?.compactMap { $0 as? Double }, [0.5, -1.25])
+        XCTAssertEqual((v["gains"] as? [Any?])?.compactMap { $0 as? Double }, [Double(Float(0.1))])
+        XCTAssertEqual((v["flags"] as? [Any?])?.compactMap { $0 as? Bool }, [true, false, true])
+        XCTAssertEqual((v["none"] as? [Any?])?.count, 0)
+    }
+
+    func testParsePackedU64AboveIntMaxThrows() throws {
+        let result = try parse("v{ids<u64>[0 9223372036854775807]}")
+        let v = try XCTUnwrap((result as? [String: Any])?["v"] as? [String: Any])
+        XCTAssertEqual((v["ids"] as? [Any?])?.compactMap { $0 as? Int }, [0, Int.max])
+
+        XCTAssertThrowsError(try parse("v{ids<u64>[18446744073709551615]}")) { error in
+            guard case .parseError(let message) = error as? GblnError else {
+                XCTFail("Expected parseError, got \(error)")
+                return
+            }
+            XCTAssertTrue(message.contains("18446744073709551615"), message)
+        }
+    }
+
     // MARK: - Comments
 
     func testParseWithComments() throws {
@@ -229,6 +367,358 @@ final class ParserTests: XCTestCase {
         XCTAssertEqual(user["name"] as? String, "Alice")
     }
 
+    func testParseRepeatedDocuments() throws {
+        let gblnString = "response{status<u16>(200)data{user{id<u32>(99)name<s16>(北京)}}}"
+
+        for _ in 0..<1000 {
+            let result = try parse(gblnString)
+
+            let dict = try XCTUnwrap(result as? [String: Any])
+            let response = try XCTUnwrap(dict["response"] as? [String: Any])
+            let data = try XCTUnwrap(response["data"] as? [String: Any])
+            let user = try XCTUnwrap(data["user"] as? [String: Any])
+
+            XCTAssertEqual(user["id"] as? Int, 99)
+            XCTAssertEqual(user["name"] as? String, "北京")
+        }
+    }
+
+    // MARK: - MINI Parsing
+
+    func testParseMiniMatchesParse() throws {
+        let mini = "user{id<u32>(123)name<s32>(Alice Smith)tags<s16>[rust swift]scores<f64>[1.5 2.5]active<b>(t)}"
+
+        let fast = try XCTUnwrap(parseMini(mini) as? [String: Any])
+        let general = try XCTUnwrap(parse(mini) as? [String: Any])
+
+        let fastUser = try XCTUnwrap(fast["user"] as? [String: Any])
+        let generalUser = try XCTUnwrap(general["user"] as? [String: Any])
+        XCTAssertEqual(fastUser["id"] as? Int, generalUser["id"] as? Int)
+        XCTAssertEqual(fastUser["name"] as? String, "Alice Smith")
+        XCTAssertEqual((fastUser["tags"] as? [Any?])?.count, 2)
+        XCTAssertEqual((fastUser["scores"] as? [Any?])?.compactMap { $0 as? Double }, [1.5, 2.5])
+        XCTAssertEqual(fastUser["active"] as? Bool, true)
+    }
+
+    func testParseMiniSerialiserOutput() throws {
+        let original: [String: Any] = ["config": ["port": 8080, "host": "localhost", "debug": false]]
+
+        let result = try parseMini(Data(toString(original).utf8))
+
+        let dict = try XCTUnwrap(result as? [String: Any])
+        let config = try XCTUnwrap(dict["config"] as? [String: Any])
+        XCTAssertEqual(config["port"] as? Int, 8080)
+        XCTAssertEqual(config["host"] as? String, "localhost")
+    }
+
+    func testParseMiniRejectsWhitespaceAndComments() throws {
+        for input in ["user{\n  id<u32>(1)\n}", "user{id<u32>(1)} :| note", "user{ id<u32>(1)}"] {
+            XCTAssertThrowsError(try parseMini(input), input) { error in
+                XCTAssertTrue(error is GblnError)
+            }
+            XCTAssertNoThrow(try parse(input), input)
+        }
+    }
+
+    // MARK: - Byte Buffer Parsing
+
+    func testParseData() throws {
+        let data = Data("user{id<u32>(123)name<s32>(Alice)}".utf8)
+        let result = try parse(data)
+
+        let dict = try XCTUnwrap(result as? [String: Any])
+        let user = try XCTUnwrap(dict["user"] as? [String: Any])
+
+        XCTAssertEqual(user["id"] as? Int, 123)
+        XCTAssertEqual(user["name"] as? String, "Alice")
+    }
+
+    func testParseByteArrayUTF8() throws {
+        let bytes = Array("<s16>(北京)".utf8)
+        let result = try parse(bytes)
+        XCTAssertEqual(result as? String, "北京")
+    }
+
+    func testParseBufferSlice() throws {
+        // Only the first document is in range; no null terminator follows it
+        let bytes = Array("<i8>(42)<i8>(43)".utf8)
+        let result = try bytes.withUnsafeBytes { buffer in
+            try parse(UnsafeRawBufferPointer(rebasing: buffer[0..<8]))
+        }
+        XCTAssertEqual(result as? Int, 42)
+    }
+
+    func testParseDataInvalidSyntax() throws {
+        let data = Data("user{id<u32>(123)".utf8)
+
+        XCTAssertThrowsError(try parse(data)) { error in
+            guard case .parseFailure = error as? GblnError else {
+                XCTFail("Expected parseFailure, got \(error)")
+                return
+            }
+        }
+    }
+
+    // MARK: - Path Extraction
+
+    func testExtractScalar() throws {
+        let message = "response{status<u16>(200)data{user{id<u32>(12345)name<s64>(Alice)}}}"
+
+        XCTAssertEqual(try extract("response.data.user.id", from: message) as? Int, 12345)
+        XCTAssertEqual(try extract("response.status", from: Data(message.utf8)) as? Int, 200)
+    }
+
+    func testExtractSubtree() throws {
+        let message = "response{status<u16>(200)data{user{id<u32>(1)role<s16>(admin)}}}"
+
+        let user = try XCTUnwrap(extract("response.data.user", from: message) as? [String: Any])
+        XCTAssertEqual(user["id"] as? Int, 1)
+        XCTAssertEqual(user["role"] as? String, "admin")
+    }
+
+    func testExtractArrayElement() throws {
+        let message = "users[{id<u32>(1)name<s32>(Alice)}{id<u32>(2)name<s32>(Bob)}]"
+
+        XCTAssertEqual(try extract("users.1.name", from: message) as? String, "Bob")
+        XCTAssertNil(try extract("users.5.name", from: message))
+    }
+
+    func testExtractKeyContainingDot() throws {
+        let message = try toString(["server.v2": ["port": 8080], "server": ["v2": ["port": 1]]])
+
+        XCTAssertEqual(try extract(["server.v2", "port"], from: message) as? Int, 8080)
+        XCTAssertEqual(try extract("server\\.v2.port", from: message) as? Int, 8080)
+        XCTAssertEqual(try extract("server.v2.port", from: message) as? Int, 1)
+    }
+
+    func testExtractMatchesDocumentLookup() throws {
+        let message = "users[{name<s16>(Ann)}{name<s16>(Bob)}]"
+        let doc = try GblnDocument(message)
+
+        XCTAssertEqual(try extract("users.1.name", from: message) as? String, try doc.value(at: "users", "1", "name") as? String)
+        XCTAssertNil(try extract("users.x.name", from: message))
+        XCTAssertNil(try doc.value(at: "users", "x", "name"))
+    }
+
+    func testExtractMissingPath() throws {
+        XCTAssertNil(try extract("user.email", from: "user{id<u32>(123)}"))
+    }
+
+    func testExtractSkipsInvalidSiblings() throws {
+        // The out-of-range sibling comes after the addressed value and is never decoded
+        let message = "msg{route<s16>(billing)payload{amount<i8>(999)}}"
+        XCTAssertEqual(try extract("msg.route", from: message) as? String, "billing")
+    }
+
+    func testExtractInvalidSyntax() throws {
+        XCTAssertThrowsError(try extract("user.id", from: "user{id<u32>123)}")) { error in
+            XCTAssertTrue(error is GblnError)
+        }
+    }
+
+    // MARK: - Validation
+
+    func testValidateValidDocuments() throws {
+        try validate("user{id<u32>(123)name<s32>(Alice)tags<s16>[a b]}")
+        try validate(Data("<s16>(北京)".utf8))
+
+        for name in ["simple", "nested", "all-types"] {
+            let path = try XCTUnwrap(Bundle.module.path(forResource: name, ofType: "gbln", inDirectory: "Fixtures/valid"))
+            try validate(Data(contentsOf: URL(fileURLWithPath: path)))
+        }
+    }
+
+    func testValidateInvalidFixtures() throws {
+        for name in ["bad-syntax", "out-of-range"] {
+            let path = try XCTUnwrap(Bundle.module.path(forResource: name, ofType: "gbln", inDirectory: "Fixtures/invalid"))
+            let data = try Data(contentsOf: URL(fileURLWithPath: path))
+
+            XCTAssertThrowsError(try validate(data), name) { error in
+                XCTAssertTrue(error is GblnError)
+            }
+        }
+    }
+
+    func testValidateTypeBounds() throws {
+        XCTAssertThrowsError(try validate("name<s4>(Alice)"))
+        XCTAssertThrowsError(try validate("user{id<u8>(1)id<u8>(2)}"))
+        XCTAssertThrowsError(try validate("value<x9>(1)"))
+    }
+
+    func testIsValid() throws {
+        XCTAssertTrue(isValid("user{id<u32>(123)name<s32>(Alice)}"))
+        XCTAssertTrue(isValid(Data("<s16>(北京)".utf8)))
+
+        XCTAssertFalse(isValid("user{id<u32>(123)"))
+        XCTAssertFalse(isValid("age<i8>(999)"))
+        XCTAssertFalse(isValid(Data("user{id<u8>(1)id<u8>(2)}".utf8)))
+    }
+
+    func testParseErrorReportsLocation() throws {
+        XCTAssertThrowsError(try parse("user{\nage<i8>(999)}")) { error in
+            guard case .parseFailure(let failure) = error as? GblnError else {
+                XCTFail("Expected parseFailure, got \(error)")
+                return
+            }
+            XCTAssertEqual(failure.reason, .intOutOfRange)
+            XCTAssertEqual(failure.offset, 14)
+            XCTAssertEqual(failure.length, 3)
+            XCTAssertEqual(failure.line, 2)
+            XCTAssertEqual(failure.column, 9)
+            XCTAssertTrue(failure.message.contains("999"), failure.message)
+        }
+    }
+
+    func testValidateFailureReportsLocation() throws {
+        XCTAssertThrowsError(try validate(Data("user{id<u8>(1)id<u8>(2)}".utf8))) { error in
+            guard case .parseFailure(let failure) = error as? GblnError else {
+                XCTFail("Expected parseFailure, got \(error)")
+                return
+            }
+            XCTAssertEqual(failure.reason, .duplicateKey)
+            XCTAssertEqual(failure.line, 1)
+            XCTAssertEqual(failure.offset, 14)
+        }
+    }
+
+    func testConcurrentParseErrorsAreNotShared() throws {
+        let lock = NSLock()
+        var mismatches: [Int] = []
+
+        DispatchQueue.concurrentPerform(iterations: 64) { i in
+            do {
+                _ = try parse("age<i8>(\(200 + i))")
+            } catch GblnError.parseFailure(let failure) where failure.message.contains("\(200 + i)") {
+                return
+            } catch {}
+
+            lock.lock()
+            mismatches.append(i)
+            lock.unlock()
+        }
+
+        XCTAssertEqual(mismatches, [])
+    }
+
+    // MARK: - Parallel Parsing
+
+    func testParseParallelMatchesSequential() throws {
+        let records = (0..<20_000).map { "{id<u32>(\($0))name<s16>(user\($0))}" }.joined()
+        let data = Data("records[\(records)]".utf8)
+
+        let result = try parseParallel(data, threads: 4)
+        let sequential = try parse(data)
+
+        XCTAssertTrue(valuesEqual(result, sequential))
+
+        let dict = try XCTUnwrap(result as? [String: Any])
+        let parsed = try XCTUnwrap(dict["records"] as? [Any?])
+        XCTAssertEqual(parsed.count, 20_000)
+
+        for i in [0, 1, 9_999, 10_000, 19_999] {
+            let record = try XCTUnwrap(parsed[i] as? [String: Any])
+            XCTAssertEqual(record["id"] as? Int, i)
+            XCTAssertEqual(record["name"] as? String, "user\(i)")
+        }
+    }
+
+    func testParseParallelSmallInput() throws {
+        let result = try parseParallel(Data("<i8>(42)".utf8))
+        XCTAssertEqual(result as? Int, 42)
+    }
+
+    func testParseParallelReportsError() throws {
+        var records = (0..<10_000).map { _ in "{id<u8>(1)}" }
+        records[7_500] = "{id<u8>(999)}"
+        let data = Data("records[\(records.joined())]".utf8)
+
+        XCTAssertThrowsError(try parseParallel(data, threads: 4)) { error in
+            XCTAssertTrue(error is GblnError)
+        }
+    }
+
+    // MARK: - Record Streams
+
+    func testParseRecords() throws {
+        let stream = "{id<u32>(1)event<s16>(login)}\n{id<u32>(2)event<s16>(logout)}\n"
+        let records = try parseRecords(stream)
+
+        XCTAssertEqual(records.count, 2)
+
+        let second = try XCTUnwrap(records[1] as? [String: Any])
+        XCTAssertEqual(second["id"] as? Int, 2)
+        XCTAssertEqual(second["event"] as? String, "logout")
+    }
+
+    func testParseRecordsWrittenByToString() throws {
+        let events: [[String: Any]] = (0..<1000).map { ["seq": $0, "ok": $0 % 2 == 0] }
+        let stream = try events.map { try toRecordLine($0) }.joined()
+
+        let records = try parseRecords(Data(stream.utf8), threads: 4)
+
+        XCTAssertEqual(records.count, 1000)
+        for (i, record) in records.enumerated() {
+            let dict = try XCTUnwrap(record as? [String: Any])
+            XCTAssertEqual(dict["seq"] as? Int, i)
+        }
+    }
+
+    func testParseRecordsSkipsEmptyLinesAndMissingFinalNewline() throws {
+        let records = try parseRecords("<i8>(1)\n\n<i8>(2)\n<n>()")
+
+        XCTAssertEqual(records.count, 3)
+        XCTAssertEqual(records[0] as? Int, 1)
+        XCTAssertEqual(records[1] as? Int, 2)
+        XCTAssertTrue(records[2] is NSNull)
+    }
+
+    func testRecordWithEmbeddedNewline() throws {
+        let record: [String: Any] = ["note": "a\nb"]
+
+        XCTAssertThrowsError(try toRecordLine(record)) { error in
+            guard case .serialiseError = error as? GblnError else {
+                XCTFail("Expected serialiseError, got \(error)")
+                return
+            }
+        }
+
+        // Framed by hand, the record is split at the line feed
+        let stream = try toString(record) + "\n" + toString(["note": "c"]) + "\n"
+        XCTAssertThrowsError(try parseRecords(stream)) { error in
+            XCTAssertTrue(error is GblnError)
+        }
+
+        // The same document is fine outside a record stream
+        let single = try XCTUnwrap(parse(toString(record)) as? [String: Any])
+        XCTAssertEqual(single["note"] as? String, "a\nb")
+    }
+
+    func testParseRecordsEmptyStream() throws {
+        XCTAssertTrue(try parseRecords("").isEmpty)
+    }
+
+    func testParseRecordsInvalidRecord() throws {
+        let stream = "<i8>(1)\n<i8>(999)\n<i8>(3)\n"
+
+        XCTAssertThrowsError(try parseRecords(stream)) { error in
+            XCTAssertTrue(error is GblnError)
+        }
+    }
+
+    // MARK: - Scanner
+
+    func testScannerBackend() throws {
+        let backend = GBLN.scannerBackend
+
+        XCTAssertTrue(["scalar", "sse42", "avx2", "neon"].contains(backend), backend)
+
+        #if arch(arm64)
+        XCTAssertEqual(backend, "neon")
+        #elseif arch(x86_64)
+        XCTAssertNotEqual(backend, "neon")
+        #endif
+    }
+
     // MARK: - Error Cases
 
     func testParseInvalidSyntax() throws {
@@ -236,10 +726,11 @@ final class ParserTests: XCTestCase {
 
         XCTAssertThrowsError(try parse(gblnString)) { error in
             XCTAssertTrue(error is GblnError)
-            if case .parseError(let msg) = error as? GblnError {
-                XCTAssertTrue(msg.contains("error") || msg.contains("Error"))
+            if case .parseFailure(let failure) = error as? GblnError {
+                XCTAssertEqual(failure.reason, .unexpectedEof)
+                XCTAssertFalse(failure.message.isEmpty)
             } else {
-                XCTFail("Expected parseError, got \(error)")
+                XCTFail("Expected parseFailure, got \(error)")
             }
         }
     }
@@ -252,6 +743,15 @@ final class ParserTests: XCTestCase {
         }
     }
 
+    func testParseDuplicateKeyInWideObject() throws {
+        let fields = (0..<100).map { "field\($0)<u8>(1)" }.joined()
+        let gblnString = "wide{\(fields)field42<u8>(2)}"
+
+        XCTAssertThrowsError(try parse(gblnString)) { error in
+            XCTAssertTrue(error is GblnError)
+        }
+    }
+
     // MARK: - File Parsing
 
     func testParseFileSimple() throws {
@@ -282,4 +782,37 @@ final class ParserTests: XCTestCase {
         XCTAssertEqual(response["status"] as? Int, 200)
         XCTAssertEqual(response["message"] as? String, "Success")
     }
+
+    func testParseFileStringsOutliveCall() throws {
+        let path = FileManager.default.temporaryDirectory.appendingPathComponent("\(UUID().uuidString).gbln").path
+        defer { try? FileManager.default.removeItem(atPath: path) }
+        try "user{name<s32>(Alice Johnson)city<s16>(Zürich)}".write(toFile: path, atomically: true, encoding: .utf8)
+
+        let result = try parseFile(at: path)
+        try FileManager.default.removeItem(atPath: path)
+
+        let user = try XCTUnwrap((result as? [String: Any])?["user"] as? [String: Any])
+        XCTAssertEqual(user["name"] as? String, "Alice Johnson")
+        XCTAssertEqual(user["city"] as? String, "Zürich")
+    }
+
+    func testParseFileCompressed() throws {
+        let path = FileManager.default.temporaryDirectory.appendingPathComponent("\(UUID().uuidString).io.gbln.xz").path
+        defer { try? FileManager.default.removeItem(atPath: path) }
+        try writeIo(["user": ["id": 42]], to: path, config: .io)
+
+        let result = try parseFile(at: path)
+
+        let user = try XCTUnwrap((result as? [String: Any])?["user"] as? [String: Any])
+        XCTAssertEqual(user["id"] as? Int, 42)
+    }
+
+    func testParseFileNonexistent() throws {
+        XCTAssertThrowsError(try parseFile(at: "/nonexistent/path/file.gbln")) { error in
+            guard case .ioError = error as? GblnError else {
+                XCTFail("Expected ioError, got \(error)")
+                return
+            }
+        }
+    }
 }
@@ -0,0 +1,138 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+import XCTest
+@testable import GBLN
+
+/// Test suite for the incremental `GblnPushParser`.
+///
+/// Tests cover:
+/// - Event sequence for objects, arrays and scalars
+/// - Chunk boundaries inside tokens and UTF-8 sequences
+/// - Incomplete input
+/// - Handler errors
+final class PushParserTests: XCTestCase {
+
+    /// Render events as strings for easy comparison.
+    private func describe(_ event: GblnStreamEvent) -> String {
+        switch event {
+        case .beginObject: return "{"
+        case .endObject: return "}"
+        case .beginArray: return "["
+        case .endArray: return "]"
+        case .key(let key): return "key:\(key)"
+        case .scalar(let value, let type): return "\(type.rawValue):\(value.map { "\($0)" } ?? "null")"
+        }
+    }
+
+    /// Feed input in chunks of the given size and collect rendered events.
+    private func collectEvents(_ input: String, chunkSize: Int) throws -> [String] {
+        var events: [String] = []
+        let parser = try GblnPushParser { event in
+            events.append(self.describe(event))
+        }
+
+        let bytes = Array(input.utf8)
+        var offset = 0
+        while offset < bytes.count {
+            let end = min(offset + chunkSize, bytes.count)
+            try parser.feed(Array(bytes[offset..<end]))
+            offset = end
+        }
+        try parser.finish()
+
+        return events
+    }
+
+    // MARK: - Event Sequence
+
+    func testObjectEvents() throws {
+        let events = try collectEvents("user{id<u32>(123)name<s32>(Alice)}", chunkSize: 1024)
+
+        XCTAssertEqual(events, [
+            "key:user", "{",
+            "key:id", "u32:123",
+            "key:name", "string:Alice",
+            "}"
+        ])
+    }
+
+    func testArrayEvents() throws {
+        let events = try collectEvents("tags<s16>[rust python swift]", chunkSize: 1024)
+
+        XCTAssertEqual(events, [
+            "key:tags", "[",
+            "string:rust", "string:python", "string:swift",
+            "]"
+        ])
+    }
+
+    func testTopLevelScalarEvents() throws {
+        XCTAssertEqual(try collectEvents("<i8>(42)", chunkSize: 1024), ["i8:42"])
+        XCTAssertEqual(try collectEvents("<n>()", chunkSize: 1024), ["null:null"])
+    }
+
+    // MARK: - Chunk Boundaries
+
+    func testSingleByteChunks() throws {
+        let input = """
+        :| Comment split across chunks
+        response{
+            status<u16>(200)
+            data{
+                city<s16>(北京)
+                flags<b>[t f]
+            }
+        }
+        """
+
+        let whole = try collectEvents(input, chunkSize: 1024)
+        let split = try collectEvents(input, chunkSize: 1)
+
+        XCTAssertEqual(split, whole)
+        XCTAssertTrue(split.contains("string:北京"))
+    }
+
+    func testOddChunkSizes() throws {
+        let input = "users[{id<u32>(1)name<s32>(Alice)}{id<u32>(2)name<s32>(Bob)}]"
+        let whole = try collectEvents(input, chunkSize: 1024)
+
+        for chunkSize in [2, 3, 5, 7] {
+            XCTAssertEqual(try collectEvents(input, chunkSize: chunkSize), whole)
+        }
+    }
+
+    // MARK: - Errors
+
+    func testFinishIncompleteInput() throws {
+        let parser = try GblnPushParser { _ in }
+        try parser.feed(Array("user{id<u32>(123)".utf8))
+
+        XCTAssertThrowsError(try parser.finish()) { error in
+            XCTAssertTrue(error is GblnError)
+        }
+    }
+
+    func testInvalidInput() throws {
+        let parser = try GblnPushParser { _ in }
+
+        XCTAssertThrowsError(try parser.feed(Array("age<i8>(999)".utf8))) { error in
+            XCTAssertTrue(error is GblnError)
+        }
+    }
+
+    func testHandlerErrorStopsParsing() throws {
+        struct Stop: Error {}
+
+        var count = 0
+        let parser = try GblnPushParser { _ in
+            count += 1
+            throw Stop()
+        }
+
+        XCTAssertThrowsError(try parser.feed(Array("tags<s16>[a b c]".utf8))) { error in
+            XCTAssertTrue(error is Stop)
+        }
+        XCTAssertEqual(count, 1)
+    }
+}
@@ -0,0 +1,141 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+import XCTest
+@testable import GBLN
+
+/// Test suite for the pull-based `GblnReader`.
+///
+/// Tests cover:
+/// - Event iteration over strings, files and pipes
+/// - Rejecting XZ-compressed files
+/// - Aggregating scalars without building a tree
+/// - Error reporting through `error` and `nextEvent()`
+final class ReaderTests: XCTestCase {
+
+    var tempDir: URL!
+
+    override func setUp() {
+        super.setUp()
+        tempDir = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        try? FileManager.default.createDirectory(at: tempDir, withIntermediateDirectories: true)
+    }
+
+    override func tearDown() {
+        try? FileManager.default.removeItem(at: tempDir)
+        super.tearDown()
+    }
+
+    /// Sum every u32 `amount` field in the reader's events.
+    private func sumAmounts(_ reader: GblnReader) -> Int {
+        var total = 0
+        var inAmount = false
+
+        for event in reader {
+            switch event {
+            case .key(let key):
+                inAmount = key == "amount"
+            case .scalar(let value as Int, .u32) where inAmount:
+                total += value
+            default:
+                break
+            }
+        }
+
+        return total
+    }
+
+    // MARK: - Iteration
+
+    func testEventSequence() throws {
+        let reader = try GblnReader("user{id<u32>(123)tags<s16>[a b]}")
+        var kinds: [String] = []
+
+        while let event = try reader.nextEvent() {
+            switch event {
+            case .beginObject: kinds.append("{")
+            case .endObject: kinds.append("}")
+            case .beginArray: kinds.append("[")
+            case .endArray: kinds.append("]")
+            case .key(let key): kinds.append(key)
+            case .scalar(_, let type): kinds.append(type.rawValue)
+            }
+        }
+
+        XCTAssertEqual(kinds, ["user", "{", "id", "u32", "tags", "[", "string", "string", "]", "}"])
+    }
+
+    func testAggregateRecords() throws {
+        let records = (1...10_000).map { "{id<u32>(\($0))amount<u32>(\($0))}" }.joined()
+        let reader = try GblnReader("records[\(records)]")
+
+        XCTAssertEqual(sumAmounts(reader), 50_005_000)
+        XCTAssertNil(reader.error)
+    }
+
+    func testReadFile() throws {
+        let records = (1...1000).map { _ in "{amount<u32>(2)}" }.joined()
+        let path = tempDir.appendingPathComponent("records.io.gbln").path
+        try "records[\(records)]".write(toFile: path, atomically: true, encoding: .utf8)
+
+        let reader = try GblnReader(contentsOfFile: path)
+
+        XCTAssertEqual(sumAmounts(reader), 2000)
+        XCTAssertNil(reader.error)
+    }
+
+    func testReadMissingFile() throws {
+        let path = tempDir.appendingPathComponent("missing.io.gbln").path
+
+        XCTAssertThrowsError(try GblnReader(contentsOfFile: path)) { error in
+            guard case .ioError = error as? GblnError else {
+                XCTFail("Expected ioError, got \(error)")
+                return
+            }
+        }
+    }
+
+    func testReadCompressedFileRejected() throws {
+        let path = tempDir.appendingPathComponent("records.io.gbln.xz").path
+        try writeIo(["records": [["amount": 2]]], to: path, config: .io)
+
+        let reader = try GblnReader(contentsOfFile: path)
+
+        XCTAssertThrowsError(try reader.nextEvent()) { error in
+            guard case .ioError(let message) = error as? GblnError else {
+                XCTFail("Expected ioError, got \(error)")
+                return
+            }
+            XCTAssertTrue(message.contains("readIo"), message)
+        }
+    }
+
+    func testReadFromPipe() throws {
+        let pipe = Pipe()
+        pipe.fileHandleForWriting.write(Data("values[{amount<u32>(4)}{amount<u32>(6)}]".utf8))
+        try pipe.fileHandleForWriting.close()
+
+        let reader = try GblnReader(contentsOfFile: "/dev/fd/\(pipe.fileHandleForReading.fileDescriptor)")
+
+        XCTAssertEqual(sumAmounts(reader), 10)
+        XCTAssertNil(reader.error)
+    }
+
+    // MARK: - Errors
+
+    func testIterationStopsAtError() throws {
+        let reader = try GblnReader("values[{amount<u32>(1)}{amount<i8>(999)}{amount<u32>(5)}]")
+
+        XCTAssertEqual(sumAmounts(reader), 1)
+        XCTAssertTrue(reader.error is GblnError)
+        XCTAssertNil(reader.next())
+    }
+
+    func testNextEventThrows() throws {
+        let reader = try GblnReader("age<i8>(999)")
+
+        XCTAssertThrowsError(try { while try reader.nextEvent() != nil {} }()) { error in
+            XCTAssertTrue(error is GblnError)
+        }
+    }
+}
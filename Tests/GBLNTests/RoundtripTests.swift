@@ -92,6 +92,21 @@ final class RoundtripTests: XCTestCase {
         XCTAssertEqual(user["name"] as? String, "Alice Johnson")
     }
 
+    func testRoundtripWideObject() throws {
+        var original: [String: Any] = [:]
+        for i in 0..<5000 {
+            original["key\(i)"] = i
+        }
+
+        let gbln = try toString(original)
+        let parsed = try parse(gbln)
+
+        let dict = try XCTUnwrap(parsed as? [String: Any])
+        XCTAssertEqual(dict.count, 5000)
+        XCTAssertEqual(dict["key0"] as? Int, 0)
+        XCTAssertEqual(dict["key4999"] as? Int, 4999)
+    }
+
     func testRoundtripArray() throws {
         let original = ["rust", "python", "swift", "kotlin"]
 
@@ -0,0 +1,130 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+import XCTest
+@testable import GBLN
+
+/// Test suite for schema-driven decoding with `GblnSchema`.
+///
+/// Tests cover:
+/// - Decoding scalars and strings into a struct
+/// - Optional and required fields
+/// - Type mismatches and invalid schemas
+final class SchemaTests: XCTestCase {
+
+    struct Reading {
+        var sensor: UInt32 = 0
+        var value: Double = 0
+        var valid: Bool = false
+        var delta: Int16 = 0
+        var unit: (UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8) = (0, 0, 0, 0, 0, 0, 0, 0)
+    }
+
+    private func makeSchema(deltaRequired: Bool = true) throws -> GblnSchema {
+        return try GblnSchema(fields: [
+            .init(path: "reading.sensor", type: .u32, offset: MemoryLayout<Reading>.offset(of: \.sensor)!),
+            .init(path: "reading.value", type: .f64, offset: MemoryLayout<Reading>.offset(of: \.value)!),
+            .init(path: "reading.valid", type: .bool, offset: MemoryLayout<Reading>.offset(of: \.valid)!),
+            .init(path: "reading.delta", type: .i16, offset: MemoryLayout<Reading>.offset(of: \.delta)!, required: deltaRequired),
+            .init(path: "reading.meta.unit", type: .string, offset: MemoryLayout<Reading>.offset(of: \.unit)!, capacity: 8)
+        ])
+    }
+
+    /// Read the null-terminated inline unit string.
+    private func unitString(_ reading: Reading) -> String {
+        var unit = reading.unit
+        return withUnsafeBytes(of: &unit) { bytes in
+            String(decoding: bytes.prefix { $0 != 0 }, as: UTF8.self)
+        }
+    }
+
+    /// Decode through the typed overload where the compiler provides it.
+    private func decode(_ schema: GblnSchema, _ message: Data, into reading: inout Reading) throws {
+        #if compiler(>=6.0)
+        try schema.decode(message, into: &reading)
+        #else
+        try withUnsafeMutableBytes(of: &reading) { target in
+            try schema.decode(message, to: target.baseAddress!)
+        }
+        #endif
+    }
+
+    // MARK: - Decoding
+
+    func testDecodeIntoStruct() throws {
+        let schema = try makeSchema()
+        let message = Data("reading{sensor<u32>(42)value<f64>(21.5)valid<b>(t)delta<i16>(-300)meta{unit<s8>(°C)}}".utf8)
+
+        var reading = Reading()
+        try decode(schema, message, into: &reading)
+
+        XCTAssertEqual(reading.sensor, 42)
+        XCTAssertEqual(reading.value, 21.5)
+        XCTAssertEqual(reading.valid, true)
+        XCTAssertEqual(reading.delta, -300)
+        XCTAssertEqual(unitString(reading), "°C")
+    }
+
+    func testDecodeSkipsUnknownFields() throws {
+        let schema = try makeSchema()
+        let message = Data("reading{id<s32>(abc)sensor<u32>(7)value<f64>(1.0)valid<b>(f)delta<i16>(0)meta{unit<s8>(K)source<s16>(lab)}}".utf8)
+
+        var reading = Reading()
+        try decode(schema, message, into: &reading)
+
+        XCTAssertEqual(reading.sensor, 7)
+        XCTAssertEqual(unitString(reading), "K")
+    }
+
+    func testDecodeOptionalFieldLeftUntouched() throws {
+        let schema = try makeSchema(deltaRequired: false)
+        let message = Data("reading{sensor<u32>(1)value<f64>(0.5)valid<b>(t)meta{unit<s8>(m)}}".utf8)
+
+        var reading = Reading()
+        reading.delta = 99
+        try decode(schema, message, into: &reading)
+
+        XCTAssertEqual(reading.delta, 99)
+    }
+
+    // MARK: - Errors
+
+    func testDecodeMissingRequiredField() throws {
+        let schema = try makeSchema()
+        let message = Data("reading{sensor<u32>(1)value<f64>(0.5)valid<b>(t)meta{unit<s8>(m)}}".utf8)
+
+        var reading = Reading()
+        XCTAssertThrowsError(try decode(schema, message, into: &reading)) { error in
+            XCTAssertTrue(error is GblnError)
+        }
+    }
+
+    func testDecodeTypeMismatch() throws {
+        let schema = try makeSchema()
+        let message = Data("reading{sensor<u16>(1)value<f64>(0.5)valid<b>(t)delta<i16>(0)meta{unit<s8>(m)}}".utf8)
+
+        var reading = Reading()
+        XCTAssertThrowsError(try decode(schema, message, into: &reading)) { error in
+            XCTAssertTrue(error is GblnError)
+        }
+    }
+
+    func testSchemaRejectsContainerField() throws {
+        XCTAssertThrowsError(try GblnSchema(fields: [.init(path: "reading", type: .object, offset: 0)])) { error in
+            guard case .validationError = error as? GblnError else {
+                XCTFail("Expected validationError, got \(error)")
+                return
+            }
+        }
+    }
+
+    #if compiler(>=6.0)
+    func testSchemaDoesNotFitTarget() throws {
+        let schema = try GblnSchema(fields: [.init(path: "big", type: .u64, offset: 8)])
+        var small: UInt32 = 0
+
+        XCTAssertEqual(schema.extent, 16)
+        XCTAssertThrowsError(try schema.decode(Data("big<u64>(1)".utf8), into: &small))
+    }
+    #endif
+}
@@ -101,6 +101,42 @@ final class ValueConversionTests: XCTestCase {
         XCTAssertTrue(gbln.contains("Hello👋"))
     }
 
+    func testMultibyteStringAutoSelectS64() throws {
+        let value = String(repeating: "北", count: 64)  // 64 characters, 192 bytes
+        let gbln = try toString(value)
+
+        // Should count code points, not bytes
+        XCTAssertTrue(gbln.contains("<s64>"))
+    }
+
+    func testMultibyteStringAutoSelectS256() throws {
+        let value = String(repeating: "北", count: 65)  // 65 characters
+        let gbln = try toString(value)
+
+        XCTAssertTrue(gbln.contains("<s256>"))
+    }
+
+    func testCombinedEmojiCountsCodePoints() throws {
+        // One grapheme cluster made of 7 code points (family emoji with ZWJs)
+        let family = "👨‍👩‍👧‍👦"
+        let value = String(repeating: family, count: 10)  // 10 graphemes, 70 code points
+        let gbln = try toString(value)
+
+        // sN bounds code points, so 70 code points need s256
+        XCTAssertTrue(gbln.contains("<s256>"))
+
+        let parsed = try parse(gbln)
+        XCTAssertEqual(parsed as? String, value)
+    }
+
+    func testParseStringTooLongForHint() throws {
+        // 3 characters do not fit s2, even though each is a single grapheme
+        XCTAssertThrowsError(try parse("<s2>(北京市)")) { error in
+            XCTAssertTrue(error is GblnError)
+        }
+        XCTAssertEqual(try parse("<s2>(北京)") as? String, "北京")
+    }
+
     // MARK: - Bidirectional Conversion
 
     func testBidirectionalInteger() throws {